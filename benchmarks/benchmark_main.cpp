@@ -0,0 +1,440 @@
+/**
+ * @file        benchmark_main.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2025-11-07
+ * @version     1.0.0
+ *
+ * @brief Google Benchmark suite for ThreadSafeQueue and WorkerPool.
+ *
+ * @details
+ * Measured scenarios:
+ *  - Queue throughput for every backend across producer/consumer matrices
+ *    (1:1, 1:N, N:1, N:M) and element sizes (8, 64, 256 bytes).
+ *  - WorkerPool throughput with empty tasks, per scheduling mode.
+ *  - Submit-to-start latency percentiles (`p50_ns`, `p99_ns`, `p999_ns`, `max_ns`).
+ *  - Time spent in `WorkerPool::stop()` with and without pending tasks.
+ *  - Timing wheel insert + cancel cost with up to 100 000 pending timers.
+ *  - `parallel_reduce()` over 4 M doubles per worker count and grain.
+ *  - Re-runs of a layered `TaskGraph` (per-node dispatch overhead).
+ *
+ * Run through the `run_benchmarks` target to get `benchmark_results.json` in the
+ * build directory, or pass the usual `--benchmark_*` flags to `benchmarks`.
+ */
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+/* Project libraries */
+
+#include "logger.h"
+#include "parallel_algorithms.h"
+#include "task.h"
+#include "task_graph.h"
+#include "thread_safe_queue.h"
+#include "worker_pool.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Elements transferred per queue benchmark iteration.
+ */
+static constexpr std::size_t ITEMS_PER_RUN = 1 << 15;
+
+/**
+ * @brief Capacity of every queue under test, so bounded and unbounded backends
+ *        apply the same back-pressure.
+ */
+static constexpr std::size_t QUEUE_CAPACITY = 1024;
+
+/**
+ * @brief Empty tasks submitted per pool throughput iteration.
+ */
+static constexpr int TASKS_PER_RUN = 4096;
+
+/**
+ * @brief Latency samples taken per latency benchmark iteration.
+ */
+static constexpr int LATENCY_SAMPLES = 256;
+
+/**
+ * @brief Queue element of `Bytes` bytes.
+ */
+template <std::size_t Bytes>
+struct Payload
+{
+    std::array<unsigned char, Bytes> bytes;
+};
+
+/**
+ * @brief Deadline key of a payload for `DeadlineBackend`: its first byte, in ticks, so
+ *        consecutive pushes land at different heap positions.
+ */
+template <std::size_t Bytes>
+struct DeadlineOf<Payload<Bytes>>
+{
+    static std::chrono::steady_clock::time_point get(const Payload<Bytes>& value) {
+        return std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(value.bytes[0]));
+    }
+};
+
+/**
+ * @brief Producer/consumer matrix: 1:1, 1:N, N:1 and N:M.
+ */
+static void ProducerConsumerMatrix(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"producers", "consumers"});
+    bench->Args({1, 1})->Args({1, 4})->Args({4, 1})->Args({4, 4});
+}
+
+/**
+ * @brief Returns the value at quantile `q` of the sorted `samples`.
+ */
+static double Percentile(const std::vector<std::int64_t>& samples, double q) {
+    if (samples.empty()) return 0.0;
+    const auto index = static_cast<std::size_t>(q * static_cast<double>(samples.size() - 1));
+    return static_cast<double>(samples[index]);
+}
+
+/*****************************************************************************/
+
+/* ThreadSafeQueue */
+
+/**
+ * @brief Moves `ITEMS_PER_RUN` elements from `producers` to `consumers` threads.
+ *
+ * @details
+ * GIVEN a queue bounded to `QUEUE_CAPACITY`
+ * WHEN producers push their share and the queue is closed once they are done
+ * THEN the iteration ends when consumers have drained it; thread start-up is part
+ * of the measured time and is amortized over the transferred elements.
+ */
+template <typename Backend, std::size_t Bytes>
+static void BM_QueueThroughput(benchmark::State& state) {
+    const auto        producers    = static_cast<std::size_t>(state.range(0));
+    const auto        consumers    = static_cast<std::size_t>(state.range(1));
+    const std::size_t per_producer = ITEMS_PER_RUN / producers;
+
+    for (auto _ : state) {
+        ThreadSafeQueue<Payload<Bytes>, Backend> queue(QUEUE_CAPACITY);
+
+        std::vector<std::thread> consumer_threads;
+        for (std::size_t c = 0; c < consumers; ++c)
+            consumer_threads.emplace_back([&queue] {
+                Payload<Bytes> item;
+                while (queue.pop(item)) benchmark::DoNotOptimize(item);
+            });
+
+        std::vector<std::thread> producer_threads;
+        for (std::size_t p = 0; p < producers; ++p)
+            producer_threads.emplace_back([&queue, per_producer] {
+                for (std::size_t i = 0; i < per_producer; ++i) {
+                    Payload<Bytes> item{};
+                    item.bytes[0] = static_cast<unsigned char>(i);
+                    queue.push(std::move(item));
+                }
+            });
+
+        for (auto& t : producer_threads) t.join();
+        queue.close();
+        for (auto& t : consumer_threads) t.join();
+    }
+
+    const auto items = static_cast<std::int64_t>(per_producer * producers);
+    state.SetItemsProcessed(state.iterations() * items);
+    state.SetBytesProcessed(state.iterations() * items * static_cast<std::int64_t>(Bytes));
+}
+
+BENCHMARK_TEMPLATE(BM_QueueThroughput, MutexBackend, 8)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, MutexBackend, 64)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, MutexBackend, 256)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_QueueThroughput, MpmcRingBackend, 8)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, MpmcRingBackend, 64)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, MpmcRingBackend, 256)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_QueueThroughput, PriorityBackend, 8)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, PriorityBackend, 64)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, PriorityBackend, 256)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_QueueThroughput, DeadlineBackend, 8)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, DeadlineBackend, 64)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, DeadlineBackend, 256)
+    ->Apply(ProducerConsumerMatrix)
+    ->UseRealTime();
+
+/**
+ * @brief The SPSC ring only supports one producer and one consumer.
+ */
+static void SingleProducerSingleConsumer(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"producers", "consumers"});
+    bench->Args({1, 1});
+}
+
+BENCHMARK_TEMPLATE(BM_QueueThroughput, SpscRingBackend, 8)
+    ->Apply(SingleProducerSingleConsumer)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, SpscRingBackend, 64)
+    ->Apply(SingleProducerSingleConsumer)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_QueueThroughput, SpscRingBackend, 256)
+    ->Apply(SingleProducerSingleConsumer)
+    ->UseRealTime();
+
+/*****************************************************************************/
+
+/* WorkerPool */
+
+/**
+ * @brief Pool configurations: worker count × scheduling mode (0 = shared, 1 = stealing).
+ */
+static void PoolMatrix(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"workers", "stealing"});
+    for (int workers : {1, 2, 4})
+        for (int stealing : {0, 1}) bench->Args({workers, stealing});
+}
+
+static WorkerPool::SchedulingMode ModeArg(std::int64_t stealing) {
+    return stealing != 0 ? WorkerPool::SchedulingMode::WorkStealing
+                         : WorkerPool::SchedulingMode::SharedQueue;
+}
+
+/**
+ * @brief Submits `TASKS_PER_RUN` empty tasks and waits for the pool to go idle.
+ */
+static void BM_PoolEmptyTaskThroughput(benchmark::State& state) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool            pool(queue, ModeArg(state.range(1)));
+    pool.start(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        for (int i = 0; i < TASKS_PER_RUN; ++i) pool.submit(Task([] {}));
+        pool.wait_idle();
+    }
+
+    pool.stop();
+    state.SetItemsProcessed(state.iterations() * TASKS_PER_RUN);
+}
+
+BENCHMARK(BM_PoolEmptyTaskThroughput)->Apply(PoolMatrix)->UseRealTime();
+
+/**
+ * @brief Measures the delay between `submit()` and the start of the task.
+ *
+ * @details
+ * Every task records `now - submitted`; the percentiles of all samples are reported
+ * as counters (nanoseconds) next to the usual timing.
+ */
+static void BM_PoolSubmitToStartLatency(benchmark::State& state) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool            pool(queue, ModeArg(state.range(1)));
+    pool.start(static_cast<int>(state.range(0)));
+
+    std::vector<std::int64_t> batch(LATENCY_SAMPLES);
+    std::vector<std::int64_t> samples;
+
+    for (auto _ : state) {
+        for (int i = 0; i < LATENCY_SAMPLES; ++i) {
+            std::int64_t*           slot      = &batch[static_cast<std::size_t>(i)];
+            const Clock::time_point submitted = Clock::now();
+            pool.submit(Task([slot, submitted] {
+                *slot = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                             submitted)
+                            .count();
+            }));
+        }
+        pool.wait_idle();
+        samples.insert(samples.end(), batch.begin(), batch.end());
+    }
+
+    pool.stop();
+
+    std::sort(samples.begin(), samples.end());
+    state.counters["p50_ns"]  = Percentile(samples, 0.50);
+    state.counters["p99_ns"]  = Percentile(samples, 0.99);
+    state.counters["p999_ns"] = Percentile(samples, 0.999);
+    state.counters["max_ns"]  = samples.empty() ? 0.0 : static_cast<double>(samples.back());
+    state.SetItemsProcessed(state.iterations() * LATENCY_SAMPLES);
+}
+
+BENCHMARK(BM_PoolSubmitToStartLatency)->Apply(PoolMatrix)->UseRealTime();
+
+/**
+ * @brief Times `stop()` alone, with `range(1)` tasks still queued when it is called.
+ */
+static void BM_PoolShutdown(benchmark::State& state) {
+    const int workers = static_cast<int>(state.range(0));
+    const int pending = static_cast<int>(state.range(1));
+
+    for (auto _ : state) {
+        ThreadSafeQueue<Task> queue;
+        WorkerPool            pool(queue);
+        pool.start(workers);
+        for (int i = 0; i < pending; ++i) pool.submit(Task([] {}));
+
+        const auto begin = Clock::now();
+        pool.stop();
+        state.SetIterationTime(std::chrono::duration<double>(Clock::now() - begin).count());
+    }
+}
+
+BENCHMARK(BM_PoolShutdown)
+    ->ArgNames({"workers", "pending"})
+    ->Args({1, 0})
+    ->Args({4, 0})
+    ->Args({4, 1024})
+    ->UseManualTime();
+
+/**
+ * @brief Schedules and then cancels `range(0)` timers due in an hour.
+ *
+ * @details
+ * Measures the wheel's insert and cancel paths with many pending timers; the
+ * timers never fire.
+ */
+static void BM_TimerScheduleCancel(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    ThreadSafeQueue<Task> queue;
+    WorkerPool            pool(queue);
+    pool.start(1);
+
+    std::vector<TimerHandle> handles;
+    handles.reserve(count);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i)
+            handles.push_back(pool.schedule_after(std::chrono::hours(1), [] {}));
+        for (auto& handle : handles) handle.cancel();
+        handles.clear();
+    }
+
+    pool.stop();
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_TimerScheduleCancel)->ArgName("timers")->Arg(1000)->Arg(100000);
+
+/*****************************************************************************/
+
+/* Parallel algorithms */
+
+/**
+ * @brief Sums `ELEMENTS` doubles with `parallel_reduce()`.
+ *
+ * @details
+ * `range(0)` workers (plus the calling thread); `range(1)` is the grain, `0` meaning
+ * `AUTO_GRAIN`. Compare the items/s across worker counts to read the speed-up.
+ */
+static void BM_ParallelReduceSum(benchmark::State& state) {
+    constexpr std::size_t ELEMENTS = 1 << 22;
+    const std::vector<double> values(ELEMENTS, 1.0);
+
+    ThreadSafeQueue<Task> queue;
+    WorkerPool            pool(queue);
+    if (state.range(0) > 0) pool.start(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        const double sum = parallel_reduce(
+            pool, IndexRange{0, ELEMENTS}, 0.0,
+            [&values](IndexRange r, double acc) {
+                for (std::size_t i = r.begin; i < r.end; ++i) acc += values[i];
+                return acc;
+            },
+            [](double a, double b) { return a + b; }, static_cast<std::size_t>(state.range(1)));
+        benchmark::DoNotOptimize(sum);
+    }
+
+    pool.stop();
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ELEMENTS));
+}
+
+BENCHMARK(BM_ParallelReduceSum)
+    ->ArgNames({"workers", "grain"})
+    ->Args({0, 0})
+    ->Args({1, 0})
+    ->Args({3, 0})
+    ->Args({3, 4096})
+    ->UseRealTime();
+
+/**
+ * @brief Re-runs a graph of 16 layers of `range(0)` empty nodes, each layer fully
+ *        connected to the next one.
+ */
+static void BM_TaskGraphLayers(benchmark::State& state) {
+    constexpr int LAYERS = 16;
+    const int     width  = static_cast<int>(state.range(0));
+
+    ThreadSafeQueue<Task> queue;
+    WorkerPool            pool(queue);
+    pool.start(4);
+
+    TaskGraph                     graph;
+    std::vector<TaskGraph::NodeId> previous;
+    for (int layer = 0; layer < LAYERS; ++layer) {
+        std::vector<TaskGraph::NodeId> current;
+        for (int i = 0; i < width; ++i) {
+            current.push_back(graph.add_node([] {}));
+            for (auto from : previous) graph.add_edge(from, current.back());
+        }
+        previous.swap(current);
+    }
+
+    for (auto _ : state) graph.run(pool);
+
+    pool.stop();
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(graph.size()));
+}
+
+BENCHMARK(BM_TaskGraphLayers)->ArgName("width")->Arg(1)->Arg(8)->UseRealTime();
+
+/*****************************************************************************/
+
+/* Entry point */
+
+/**
+ * @brief Runs the suite with pool INFO logging silenced, so it does not mix with the
+ *        benchmark report.
+ */
+int main(int argc, char** argv) {
+    Logger::set_min_level(Logger::Level::WARN);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
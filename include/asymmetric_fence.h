@@ -0,0 +1,88 @@
+/**
+ * @file        asymmetric_fence.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-22>
+ * @version     1.0.0
+ *
+ * @brief       Asymmetric store-load fences for fast-path / slow-path handshakes.
+ *
+ * @details
+ * A parking protocol needs a store-load barrier on both sides: the waiter raises a
+ * flag and re-reads the data, the publisher writes the data and reads the flag.
+ * When one side runs on every operation and the other only when it is about to
+ * sleep, the cost can be moved entirely to the rare side:
+ * - `asymmetric_light_fence()` is called on the fast path. It only stops the compiler
+ *   from reordering.
+ * - `asymmetric_heavy_fence()` is called on the slow path. It makes every running
+ *   thread of the process execute a full barrier (`membarrier(2)` with
+ *   `MEMBARRIER_CMD_PRIVATE_EXPEDITED`), so it orders against the light fences as if
+ *   they were sequentially consistent ones.
+ *
+ * @note
+ * On other platforms, or kernels without the expedited command (before Linux 4.14),
+ * both calls fall back to `std::atomic_thread_fence(std::memory_order_seq_cst)`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*****************************************************************************/
+
+/**
+ * @brief Registers the process for expedited membarriers, once.
+ *
+ * @return `true` if `asymmetric_heavy_fence()` can rely on `membarrier(2)`.
+ */
+inline bool asymmetric_fence_supported() {
+#if defined(__linux__) && defined(__NR_membarrier)
+    static const bool supported = [] {
+        constexpr int CMD_QUERY                      = 0;
+        constexpr int CMD_PRIVATE_EXPEDITED          = 1 << 3;
+        constexpr int CMD_REGISTER_PRIVATE_EXPEDITED = 1 << 4;
+
+        const long commands = syscall(__NR_membarrier, CMD_QUERY, 0, 0);
+        if (commands < 0 || (commands & CMD_PRIVATE_EXPEDITED) == 0) return false;
+        return syscall(__NR_membarrier, CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Fast-path half of the handshake.
+ */
+inline void asymmetric_light_fence() {
+    if (asymmetric_fence_supported())
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    else
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+/**
+ * @brief Slow-path half of the handshake.
+ */
+inline void asymmetric_heavy_fence() {
+#if defined(__linux__) && defined(__NR_membarrier)
+    constexpr int CMD_PRIVATE_EXPEDITED = 1 << 3;
+    if (asymmetric_fence_supported()) {
+        syscall(__NR_membarrier, CMD_PRIVATE_EXPEDITED, 0, 0);
+        return;
+    }
+#endif
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
@@ -0,0 +1,207 @@
+/**
+ * @file        cancellation.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-14>
+ * @version     1.0.0
+ *
+ * @brief       Cooperative cancellation: `CancellationSource` and `CancellationToken`.
+ *
+ * @details
+ * A source owns a cancellation flag and hands out tokens observing it:
+ *  - `WorkerPool::submit(task, token)` attaches a token to the task; a worker that
+ *    dequeues a task whose token is cancelled drops it without running its body;
+ *  - a running task can poll `token.is_cancelled()` and return early.
+ *
+ * Source and tokens share one small intrusively reference-counted flag, so a token is
+ * pointer-sized and copying it is a single atomic increment.
+ *
+ * Example:
+ * ```cpp
+ * CancellationSource session;
+ * for (auto& chunk : request.chunks())
+ *     pool.submit([&chunk, token = session.token()] {
+ *         if (!token.is_cancelled()) encode(chunk);
+ *     }, session.token());
+ * ...
+ * session.cancel();   // client went away: queued chunks are skipped
+ * ```
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+
+/*****************************************************************************/
+
+/**
+ * @struct CancellationState
+ * @brief Flag shared by a `CancellationSource` and its tokens.
+ */
+struct CancellationState
+{
+    std::atomic<int>  refs{1};          /**< Sources and tokens referring to the flag. */
+    std::atomic<bool> cancelled{false}; /**< Set once by `CancellationSource::cancel()`. */
+};
+
+/**
+ * @class CancellationToken
+ * @brief Read-only view of a cancellation flag.
+ *
+ * @details
+ * A default-constructed token is never cancelled. Tokens are cheap to copy and can be
+ * read from any thread.
+ */
+class CancellationToken
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs a token that can never be cancelled.
+     */
+    CancellationToken() noexcept = default;
+
+    /**
+     * @brief Copy constructor; shares the flag.
+     */
+    CancellationToken(const CancellationToken& other) noexcept;
+
+    /**
+     * @brief Move constructor; leaves `other` empty.
+     */
+    CancellationToken(CancellationToken&& other) noexcept;
+
+    /**
+     * @brief Copy assignment operator; shares `other`'s flag.
+     */
+    CancellationToken& operator=(const CancellationToken& other) noexcept;
+
+    /**
+     * @brief Move assignment operator; leaves `other` empty.
+     */
+    CancellationToken& operator=(CancellationToken&& other) noexcept;
+
+    /**
+     * @brief Releases the flag.
+     */
+    ~CancellationToken();
+
+    /**
+     * @brief Returns `true` once the source has been cancelled.
+     */
+    bool is_cancelled() const noexcept
+    {
+        return state != nullptr && state->cancelled.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns `true` if the token is attached to a source.
+     */
+    bool can_be_cancelled() const noexcept { return state != nullptr; }
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    friend class CancellationSource;
+
+    /**
+     * @brief Shares `state` (one reference is added).
+     */
+    explicit CancellationToken(CancellationState* state) noexcept;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Shared flag, or `nullptr` for a token that is never cancelled.
+     */
+    CancellationState* state = nullptr;
+
+    /******************************************************************/
+};
+
+/**
+ * @class CancellationSource
+ * @brief Owner of a cancellation flag; cancels every token it handed out.
+ *
+ * @details
+ * Copies share the same flag. Cancellation is sticky: once cancelled, a source and
+ * all its tokens stay cancelled.
+ */
+class CancellationSource
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Creates a new, not cancelled flag.
+     */
+    CancellationSource();
+
+    /**
+     * @brief Copy constructor; shares the flag.
+     */
+    CancellationSource(const CancellationSource& other) noexcept;
+
+    /**
+     * @brief Copy assignment operator; shares `other`'s flag.
+     */
+    CancellationSource& operator=(const CancellationSource& other) noexcept;
+
+    /**
+     * @brief Releases the flag (tokens keep it alive).
+     */
+    ~CancellationSource();
+
+    /**
+     * @brief Returns a token observing this source.
+     */
+    CancellationToken token() const noexcept;
+
+    /**
+     * @brief Requests cancellation.
+     *
+     * @return `true` if this call cancelled the source, `false` if it already was.
+     *
+     * @details
+     * GIVEN tasks submitted with tokens of this source,
+     * WHEN `cancel()` is called,
+     * THEN queued tasks are dropped when dequeued and running tasks see
+     * `is_cancelled() == true` at their next poll.
+     */
+    bool cancel() noexcept;
+
+    /**
+     * @brief Returns `true` once `cancel()` has been called.
+     */
+    bool is_cancelled() const noexcept;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Shared flag (never `nullptr`).
+     */
+    CancellationState* state;
+
+    /******************************************************************/
+};
+
+#include "cancellation.ipp"
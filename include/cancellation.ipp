@@ -0,0 +1,107 @@
+/**
+ * @file        cancellation.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-14>
+ * @version     1.0.0
+ *
+ * @brief       Inline implementation of CancellationToken and CancellationSource.
+ *
+ * @details
+ * Kept inline because tokens travel inside every `Task` and are moved along with it.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "cancellation.h"
+
+/*****************************************************************************/
+
+/* Internal helpers */
+
+inline void cancellation_retain(CancellationState* state) noexcept {
+    if (state != nullptr) state->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void cancellation_release(CancellationState* state) noexcept {
+    if (state != nullptr && state->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete state;
+}
+
+/*****************************************************************************/
+
+/* CancellationToken */
+
+inline CancellationToken::CancellationToken(CancellationState* state) noexcept : state(state) {
+    cancellation_retain(state);
+}
+
+inline CancellationToken::CancellationToken(const CancellationToken& other) noexcept
+    : state(other.state) {
+    cancellation_retain(state);
+}
+
+inline CancellationToken::CancellationToken(CancellationToken&& other) noexcept
+    : state(other.state) {
+    other.state = nullptr;
+}
+
+inline CancellationToken& CancellationToken::operator=(const CancellationToken& other) noexcept {
+    cancellation_retain(other.state);
+    cancellation_release(state);
+    state = other.state;
+    return *this;
+}
+
+inline CancellationToken& CancellationToken::operator=(CancellationToken&& other) noexcept {
+    if (this != &other) {
+        cancellation_release(state);
+        state       = other.state;
+        other.state = nullptr;
+    }
+    return *this;
+}
+
+inline CancellationToken::~CancellationToken() {
+    cancellation_release(state);
+}
+
+/*****************************************************************************/
+
+/* CancellationSource */
+
+inline CancellationSource::CancellationSource() : state(new CancellationState()) {}
+
+inline CancellationSource::CancellationSource(const CancellationSource& other) noexcept
+    : state(other.state) {
+    cancellation_retain(state);
+}
+
+inline CancellationSource& CancellationSource::operator=(const CancellationSource& other) noexcept {
+    cancellation_retain(other.state);
+    cancellation_release(state);
+    state = other.state;
+    return *this;
+}
+
+inline CancellationSource::~CancellationSource() {
+    cancellation_release(state);
+}
+
+inline CancellationToken CancellationSource::token() const noexcept {
+    return CancellationToken(state);
+}
+
+/**
+ * @brief Sets the flag; the release pairs with the acquire in `is_cancelled()`.
+ */
+inline bool CancellationSource::cancel() noexcept {
+    return !state->cancelled.exchange(true, std::memory_order_acq_rel);
+}
+
+inline bool CancellationSource::is_cancelled() const noexcept {
+    return state->cancelled.load(std::memory_order_acquire);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,118 @@
+/**
+ * @file        cpu_affinity.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-04>
+ * @version     1.0.0
+ *
+ * @brief       CPU pinning policies for WorkerPool threads.
+ *
+ * @details
+ * `CpuAffinity` turns an `AffinityPolicy` into a per-worker CPU assignment and applies
+ * it with `pthread_setaffinity_np`:
+ * - `Compact`       → fill the hardware threads of one core, then the next core of the
+ *                     same package, then the next package (shared caches, low latency).
+ * - `Scatter`       → one worker per core, alternating packages, before reusing SMT
+ *                     siblings (maximum aggregate cache and memory bandwidth).
+ * - `CpuList`       → the user-provided CPU ids, assigned round-robin.
+ * - `ProcessCpuset` → every worker may run on any CPU of the process cpuset
+ *                     (`sched_getaffinity`), e.g. the CPUs granted by a container.
+ *
+ * Only CPUs in the process cpuset are ever used. Topology comes from
+ * `/sys/devices/system/cpu/cpuN/topology`; missing entries fall back to treating
+ * each CPU as its own core.
+ *
+ * @note
+ * Pinning is implemented for Linux. On other platforms `pin()` is a no-op returning
+ * `false`, and the pool keeps running unpinned.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/*****************************************************************************/
+
+/**
+ * @enum AffinityMode
+ * @brief Strategy used to map workers to CPUs.
+ */
+enum class AffinityMode
+{
+    None,          /**< Threads float freely (default). */
+    Compact,       /**< Pack workers onto neighbouring hardware threads. */
+    Scatter,       /**< Spread workers across cores and packages. */
+    CpuList,       /**< Use the explicit `AffinityPolicy::cpus` list. */
+    ProcessCpuset  /**< Restrict every worker to the whole process cpuset. */
+};
+
+/**
+ * @struct AffinityPolicy
+ * @brief Pinning policy passed to `WorkerPool::set_affinity()`.
+ */
+struct AffinityPolicy
+{
+    AffinityMode     mode = AffinityMode::None; /**< Mapping strategy. */
+    std::vector<int> cpus;                      /**< CPU ids for `AffinityMode::CpuList`. */
+};
+
+/**
+ * @struct CpuTopology
+ * @brief Location of one logical CPU.
+ */
+struct CpuTopology
+{
+    int cpu;     /**< Logical CPU id. */
+    int package; /**< Physical package (socket) id. */
+    int core;    /**< Core id within the package. */
+};
+
+/**
+ * @class CpuAffinity
+ * @brief Static helpers to compute and apply worker CPU assignments.
+ */
+class CpuAffinity
+{
+   public:
+    /**
+     * @brief Returns the logical CPUs the process may run on, in ascending order.
+     */
+    static std::vector<int> allowed_cpus();
+
+    /**
+     * @brief Returns the topology of the CPUs in the process cpuset.
+     */
+    static std::vector<CpuTopology> topology();
+
+    /**
+     * @brief Orders `cpus` according to `mode` (`Compact` or `Scatter`).
+     *
+     * @param mode Ordering strategy; other modes keep the input order.
+     * @param cpus Topology of the candidate CPUs.
+     * @return CPU ids in the order workers should take them.
+     */
+    static std::vector<int> order(AffinityMode mode, std::vector<CpuTopology> cpus);
+
+    /**
+     * @brief Computes the CPU slots used by `policy` on this machine.
+     *
+     * @return One entry per slot; worker `i` uses slot `i % slots.size()`. Empty when
+     *         the policy pins nothing (`None`, or no usable CPU).
+     */
+    static std::vector<std::vector<int>> plan(const AffinityPolicy& policy);
+
+    /**
+     * @brief Restricts `thread` to `cpus`.
+     *
+     * @return `true` on success.
+     */
+    static bool pin(std::thread& thread, const std::vector<int>& cpus);
+};
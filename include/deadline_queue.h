@@ -0,0 +1,175 @@
+/**
+ * @file        deadline_queue.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-15>
+ * @version     1.0.0
+ *
+ * @brief       Earliest-deadline-first backend for ThreadSafeQueue.
+ *
+ * @details
+ * `ThreadSafeQueue<T, DeadlineBackend>` keeps its elements in a binary min-heap keyed
+ * by `(deadline, arrival)`:
+ *  - `push()` reads the element's deadline through `DeadlineOf<T>` and sifts it up,
+ *    O(log n);
+ *  - `pop()` returns the element whose deadline is the earliest, O(log n); elements
+ *    with the same deadline keep their FIFO order.
+ *
+ * Elements without a deadline (`time_point::max()`) are served after every element
+ * that has one, in FIFO order among themselves. Combined with the WorkerPool's
+ * expiry check, tasks that can still make their deadline are run first and tasks
+ * that cannot are shed when dequeued.
+ *
+ * The interface is the one of the mutex backend: both share the `LockedQueue` core,
+ * this backend only provides the heap storage.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Project libraries */
+
+#include "locked_queue.h"
+#include "queue_backends.h"
+
+/*****************************************************************************/
+
+/**
+ * @struct DeadlineOf
+ * @brief Reads the deadline of a queued element; specialize for types without a
+ *        `deadline()` member.
+ *
+ * @tparam T Element type; by default `value.deadline()` must return a
+ *           `std::chrono::steady_clock::time_point`.
+ */
+template <typename T>
+struct DeadlineOf
+{
+    static std::chrono::steady_clock::time_point get(const T& value) { return value.deadline(); }
+};
+
+/**
+ * @class ThreadSafeQueue<T, DeadlineBackend, Trace>
+ * @brief Thread-safe queue serving the element with the earliest deadline first.
+ *
+ * @tparam T     Type of element stored in the queue (must be move-constructible and
+ *               move-assignable).
+ * @tparam Trace Tracing policy for diagnostics (see `queue_trace.h`).
+ *
+ * @details
+ * Locking, waiting, capacity and `close()` come from `LockedQueue`, so `pop()`,
+ * `pop_bulk()` and friends return elements in deadline order.
+ */
+template <typename T, typename Trace>
+class ThreadSafeQueue<T, DeadlineBackend, Trace>
+    : public LockedQueue<ThreadSafeQueue<T, DeadlineBackend, Trace>, T, Trace>
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty queue.
+     *
+     * @param max_capacity Maximum number of elements (`0` = unbounded).
+     */
+    explicit ThreadSafeQueue(std::size_t max_capacity = 0);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ThreadSafeQueue() = default;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Shared locking core; befriended so it can reach the storage hooks.
+     */
+    using Base = LockedQueue<ThreadSafeQueue, T, Trace>;
+    friend Base;
+
+    /**
+     * @brief Stored element with its heap key.
+     */
+    struct Entry
+    {
+        T                                     value;
+        std::chrono::steady_clock::time_point deadline;
+        std::uint64_t                         arrival;
+    };
+
+    /**
+     * @brief Heap order: `true` if `a` must be served after `b`.
+     */
+    struct Later
+    {
+        bool operator()(const Entry& a, const Entry& b) const
+        {
+            return a.deadline != b.deadline ? a.deadline > b.deadline : a.arrival > b.arrival;
+        }
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Inserts `data` into the heap.
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    void enqueue_locked(T&& data);
+
+    /**
+     * @brief Removes and returns the element with the earliest deadline.
+     *
+     * @note
+     * Must be called with `mtx` held and at least one element stored.
+     */
+    T dequeue_locked();
+
+    /**
+     * @brief Returns the number of stored elements.
+     */
+    std::size_t count_locked() const;
+
+    /**
+     * @brief Destroys every stored element.
+     */
+    void clear_locked();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Binary heap ordered by `Later` (earliest deadline at the front).
+     */
+    std::vector<Entry> heap;
+
+    /**
+     * @brief Arrival counter keeping equal deadlines in FIFO order.
+     */
+    std::uint64_t next_arrival = 0;
+
+    /******************************************************************/
+};
+
+#include "deadline_queue.ipp"
@@ -0,0 +1,76 @@
+/**
+ * @file        deadline_queue.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-15>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the earliest-deadline-first backend.
+ *
+ * @details
+ * Synchronization is the shared `LockedQueue` core; this file only implements the
+ * storage: `std::push_heap` / `std::pop_heap` over a vector that keeps its capacity
+ * between bursts.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <utility>
+
+/* Project libraries */
+
+#include "deadline_queue.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Constructs an empty queue.
+ *
+ * @param max_capacity Maximum number of elements, or `0` for an unbounded queue.
+ */
+template <typename T, typename Trace>
+ThreadSafeQueue<T, DeadlineBackend, Trace>::ThreadSafeQueue(std::size_t max_capacity)
+    : Base(max_capacity) {}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Inserts an element, ordered by its deadline.
+ *
+ * @details
+ * GIVEN queued elements due in 50 ms and 10 ms,
+ * WHEN an element due in 20 ms is pushed,
+ * THEN it is popped after the 10 ms one and before the 50 ms one.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, DeadlineBackend, Trace>::enqueue_locked(T&& data) {
+    const auto deadline = DeadlineOf<T>::get(data);
+    heap.push_back(Entry{std::move(data), deadline, next_arrival++});
+    std::push_heap(heap.begin(), heap.end(), Later());
+}
+
+template <typename T, typename Trace>
+T ThreadSafeQueue<T, DeadlineBackend, Trace>::dequeue_locked() {
+    std::pop_heap(heap.begin(), heap.end(), Later());
+    T data = std::move(heap.back().value);
+    heap.pop_back();
+    return data;
+}
+
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, DeadlineBackend, Trace>::count_locked() const {
+    return heap.size();
+}
+
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, DeadlineBackend, Trace>::clear_locked() {
+    heap.clear();
+}
+
+/*****************************************************************************/
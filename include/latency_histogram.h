@@ -0,0 +1,161 @@
+/**
+ * @file        latency_histogram.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-08>
+ * @version     1.0.0
+ *
+ * @brief       Log-linear (HDR-style) latency histogram used by the WorkerPool statistics.
+ *
+ * @details
+ * Values are nanoseconds. Below `2^SUB_BUCKET_BITS` every value has its own bucket;
+ * above, each power-of-two range is split into `2^SUB_BUCKET_BITS` equal sub-buckets,
+ * so any recorded value is known within about 3 % whatever its magnitude, with a
+ * fixed memory footprint and O(1) recording.
+ *
+ * Recording is designed for a **single writer** (one histogram per worker): counters
+ * are atomics updated with relaxed load + store, so recording never locks and never
+ * issues a read-modify-write, while other threads can still read a consistent-enough
+ * snapshot to merge.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/**
+ * @struct LatencySummary
+ * @brief Percentiles of a latency distribution.
+ *
+ * @details
+ * Percentiles report the highest value equivalent to their bucket, clamped to `max`.
+ */
+struct LatencySummary
+{
+    std::uint64_t            count = 0; /**< Number of samples. */
+    std::chrono::nanoseconds p50{0};    /**< Median. */
+    std::chrono::nanoseconds p99{0};    /**< 99th percentile. */
+    std::chrono::nanoseconds p999{0};   /**< 99.9th percentile. */
+    std::chrono::nanoseconds max{0};    /**< Largest sample (exact). */
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief Fixed-size log-linear histogram of nanosecond values.
+ */
+class LatencyHistogram
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief log2 of the number of sub-buckets per power of two (relative error ~2^-5).
+     */
+    static constexpr int SUB_BUCKET_BITS = 5;
+
+    /**
+     * @brief Total number of buckets, covering the whole `uint64_t` range.
+     */
+    static constexpr std::size_t BUCKET_COUNT = (65 - SUB_BUCKET_BITS) << SUB_BUCKET_BITS;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty histogram.
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    LatencyHistogram(const LatencyHistogram&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+     * @brief Records one sample; negative values count as zero.
+     *
+     * @warning Only one thread may record into a given histogram.
+     */
+    void record(std::chrono::nanoseconds value) noexcept;
+
+    /**
+     * @brief Adds every bucket of `other` to this histogram.
+     *
+     * @details
+     * Used to merge per-worker histograms into a private total, so the same
+     * single-writer rule applies to the destination.
+     */
+    void merge(const LatencyHistogram& other) noexcept;
+
+    /**
+     * @brief Returns the number of recorded samples.
+     */
+    std::uint64_t count() const noexcept;
+
+    /**
+     * @brief Computes p50 / p99 / p99.9 / max of the recorded samples.
+     */
+    LatencySummary summary() const;
+
+    /**
+     * @brief Returns the bucket index of `value` (exposed for tests).
+     */
+    static std::size_t bucket_index(std::uint64_t value) noexcept;
+
+    /**
+     * @brief Returns the highest value that maps to bucket `index`.
+     */
+    static std::uint64_t bucket_upper_bound(std::size_t index) noexcept;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Returns the value below which a fraction `quantile` of the samples lie.
+     */
+    std::uint64_t value_at(double quantile, std::uint64_t total) const noexcept;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Sample count per bucket.
+     */
+    std::atomic<std::uint64_t> buckets[BUCKET_COUNT];
+
+    /**
+     * @brief Total number of samples.
+     */
+    std::atomic<std::uint64_t> samples;
+
+    /**
+     * @brief Largest recorded value.
+     */
+    std::atomic<std::uint64_t> largest;
+
+    /******************************************************************/
+};
@@ -0,0 +1,362 @@
+/**
+ * @file        locked_queue.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-16>
+ * @version     1.0.0
+ *
+ * @brief       Shared mutex/condition-variable core of the locking ThreadSafeQueue backends.
+ *
+ * @details
+ * The mutex, priority and deadline backends only differ in how they store elements
+ * and which one they serve next. `LockedQueue` implements everything else once:
+ * locking, the data and space condition variables, capacity backpressure, `close()`
+ * semantics, bulk operations and tracing.
+ *
+ * A backend derives from `LockedQueue<Backend, T, Trace>` (CRTP) and provides four
+ * storage hooks, always called with `mtx` held:
+ *  - `void enqueue_locked(T&& data)`: stores an element;
+ *  - `T dequeue_locked()`: removes and returns the next element (never called empty);
+ *  - `std::size_t count_locked() const`: number of stored elements;
+ *  - `void clear_locked()`: destroys every stored element.
+ *
+ * Backends with extra push arguments (e.g. a `Priority`) wrap their own insertion in
+ * `push_with()` / `try_push_with()`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "queue_backends.h"
+
+/*****************************************************************************/
+
+/**
+ * @class LockedQueue
+ * @brief Mutex-protected queue skeleton shared by the locking backends.
+ *
+ * @tparam Derived Backend class providing the storage hooks.
+ * @tparam T       Type of element stored in the queue.
+ * @tparam Trace   Tracing policy for diagnostics (see `queue_trace.h`).
+ *
+ * @note
+ * Non-copyable and non-movable: waiting threads hold references to its mutex and
+ * condition variables.
+ */
+template <typename Derived, typename T, typename Trace>
+class LockedQueue
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Disable copy constructor.
+     */
+    LockedQueue(const LockedQueue&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    LockedQueue& operator=(const LockedQueue&) = delete;
+
+    /**
+     * @brief Disable move constructor.
+     */
+    LockedQueue(LockedQueue&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    LockedQueue& operator=(LockedQueue&&) = delete;
+
+    /**
+     * @brief Pushes a new element into the queue (thread-safe).
+     *
+     * @param data Rvalue reference to the element being pushed.
+     * @return `true` if the element was enqueued, or `false` if the queue was closed.
+     *
+     * @details
+     * If one or more threads are waiting in `pop()`, one of them will be notified.
+     * On a bounded queue this call blocks while the queue is full, until a consumer
+     * frees a slot or the queue is closed.
+     */
+    bool push(T&& data);
+
+    /**
+     * @brief Attempts to push an element without blocking.
+     *
+     * @param data Rvalue reference to the element being pushed.
+     * @return `true` if the element was enqueued, or `false` if the queue is full or closed.
+     *
+     * @details
+     * `data` is only moved from when the call succeeds.
+     */
+    bool try_push(T&& data);
+
+    /**
+     * @brief Pushes an element, waiting at most `timeout` for free space.
+     *
+     * @param data    Rvalue reference to the element being pushed.
+     * @param timeout Maximum time to wait while the queue is full.
+     * @return `true` if the element was enqueued, or `false` on timeout or if the
+     *         queue was closed.
+     *
+     * @details
+     * `data` is only moved from when the call succeeds.
+     */
+    template <typename Rep, typename Period>
+    bool push_for(T&& data, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Pushes a range of elements under a single lock acquisition.
+     *
+     * @tparam InputIt Input iterator whose elements are moved into the queue.
+     * @param first Beginning of the range.
+     * @param last  End of the range.
+     * @return Number of elements enqueued (less than the range size only if the queue
+     *         was closed).
+     *
+     * @details
+     * Wakes as many waiting consumers as elements were inserted (or all of them).
+     * On a bounded queue the range is inserted in chunks as space becomes available.
+     */
+    template <typename InputIt>
+    std::size_t push_bulk(InputIt first, InputIt last);
+
+    /**
+     * @brief Pops the next element, blocking until one becomes available.
+     *
+     * @param[out] data Reference to a variable where the popped value will be stored.
+     * @return `true` if an element was successfully retrieved, or `false` if the queue
+     *         was closed and empty.
+     */
+    bool pop(T& data);
+
+    /**
+     * @brief Attempts to pop the next element without blocking.
+     *
+     * @return A `nonstd::optional<T>` containing the element if available,
+     *         or `nonstd::nullopt` if the queue is empty or closed.
+     */
+    nonstd::optional<T> try_pop();
+
+    /**
+     * @brief Pops the next element, waiting at most `timeout` for one to arrive.
+     *
+     * @param[out] data    Reference where the popped value will be stored.
+     * @param      timeout Maximum time to wait while the queue is empty.
+     * @return `PopStatus::Item` if an element was stored in `data`,
+     *         `PopStatus::Timeout` if none arrived in time, or `PopStatus::Closed`
+     *         if the queue was closed and empty.
+     *
+     * @details
+     * Like `pop()`, elements still stored when the queue is closed are returned first.
+     */
+    template <typename Rep, typename Period>
+    PopStatus pop_for(T& data, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Pops the next element, waiting until `deadline` for one to arrive.
+     *
+     * @param[out] data     Reference where the popped value will be stored.
+     * @param      deadline Point in time after which the call gives up.
+     * @return Same as `pop_for()`.
+     */
+    template <typename Clock, typename Duration>
+    PopStatus pop_until(T& data, const std::chrono::time_point<Clock, Duration>& deadline);
+
+    /**
+     * @brief Pops up to `max_n` elements in one critical section, blocking for the first.
+     *
+     * @tparam OutputIt Output iterator receiving the popped elements.
+     * @param out   Destination of the popped elements (in serving order).
+     * @param max_n Maximum number of elements to pop.
+     * @return Number of elements popped, or `0` if the queue was closed and empty.
+     */
+    template <typename OutputIt>
+    std::size_t pop_bulk(OutputIt out, std::size_t max_n);
+
+    /**
+     * @brief Pops up to `max_n` elements without blocking.
+     *
+     * @tparam OutputIt Output iterator receiving the popped elements.
+     * @param out   Destination of the popped elements (in serving order).
+     * @param max_n Maximum number of elements to pop.
+     * @return Number of elements popped (`0` if the queue is empty or closed).
+     */
+    template <typename OutputIt>
+    std::size_t try_pop_bulk(OutputIt out, std::size_t max_n);
+
+    /**
+     * @brief Checks whether the queue is currently empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the current number of elements in the queue.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the maximum number of elements the queue may hold.
+     *
+     * @return The configured capacity, or `0` if the queue is unbounded.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Clears all elements currently stored in the queue.
+     *
+     * @details
+     * Does not affect the `closed` state.
+     *
+     * @warning
+     * Should be used carefully in concurrent environments to avoid discarding
+     * data being produced/consumed simultaneously.
+     */
+    void clear();
+
+    /**
+     * @brief Closes the queue, unblocking all waiting threads.
+     *
+     * @details
+     * After calling this, subsequent calls to `pop()` will return `false`
+     * (`PopStatus::Closed` for the timed pops) once the queue is empty, and
+     * `try_pop()` will return `nullopt`.
+     * Producers blocked in `push()` / `push_for()` are released and every further
+     * push is rejected.
+     */
+    void close();
+
+    /******************************************************************/
+
+    /* Protected Methods */
+
+   protected:
+    /**
+     * @brief Constructs an empty queue, optionally limited in capacity.
+     *
+     * @param max_capacity Maximum number of elements (`0` = unbounded).
+     */
+    explicit LockedQueue(std::size_t max_capacity);
+
+    /**
+     * @brief Destructor; only backends destroy the core.
+     */
+    ~LockedQueue() = default;
+
+    /**
+     * @brief Blocking push running `insert()` (which stores the element) under the lock.
+     *
+     * @return `true` if `insert()` ran, `false` if the queue was closed.
+     */
+    template <typename Insert>
+    bool push_with(Insert&& insert);
+
+    /**
+     * @brief Non-blocking push running `insert()` under the lock if there is room.
+     *
+     * @return `true` if `insert()` ran, `false` if the queue is full or closed.
+     */
+    template <typename Insert>
+    bool try_push_with(Insert&& insert);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Returns the backend (CRTP downcast).
+     */
+    Derived& self() { return static_cast<Derived&>(*this); }
+
+    /**
+     * @brief Returns the backend (CRTP downcast).
+     */
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+
+    /**
+     * @brief Checks whether the queue has reached its capacity.
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    bool full() const;
+
+    /**
+     * @brief Removes the next element into `data` and releases its slot.
+     *
+     * @note
+     * Must be called with `mtx` held and at least one element stored.
+     */
+    void take_locked(T& data);
+
+    /**
+     * @brief Moves up to `max_n` elements to `out`, in serving order.
+     *
+     * @return Number of elements moved.
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    template <typename OutputIt>
+    std::size_t drain_locked(OutputIt& out, std::size_t max_n);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Mutex protecting the backend storage and synchronization state.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Condition variable used to signal availability of data.
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Condition variable used to signal free space to blocked producers.
+     */
+    std::condition_variable space_cv;
+
+    /**
+     * @brief Maximum number of stored elements (`0` = unbounded).
+     */
+    const std::size_t max_size;
+
+    /**
+     * @brief Indicates whether the queue has been closed (graceful shutdown flag).
+     */
+    bool closed = false;
+
+    /**
+     * @brief Number of consumers currently blocked on `cv` (protected by `mtx`).
+     */
+    std::size_t waiting_consumers = 0;
+
+    /******************************************************************/
+};
+
+#include "locked_queue.ipp"
@@ -0,0 +1,391 @@
+/**
+ * @file        locked_queue.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-16>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the LockedQueue core.
+ *
+ * @details
+ * Each method ensures correct synchronization using RAII-based locking via
+ * `std::unique_lock` or `std::lock_guard`; storage is only touched through the
+ * backend's hooks while `mtx` is held.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <utility>
+
+/* Project libraries */
+
+#include "locked_queue.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Pushes a new element into the queue in a thread-safe manner.
+ *
+ * @param data Rvalue reference to the element to be enqueued.
+ * @return `true` if the element was enqueued, `false` if the queue was closed.
+ *
+ * @details
+ * GIVEN a running producer thread,
+ * WHEN `push()` is called with a new element,
+ * THEN the backend stores it and one waiting consumer thread (if any) is notified.
+ *
+ * @note
+ * Blocks only on a bounded queue that is full, until space is freed or the queue
+ * is closed.
+ */
+template <typename Derived, typename T, typename Trace>
+bool LockedQueue<Derived, T, Trace>::push(T&& data) {
+    return push_with([this, &data] { self().enqueue_locked(std::move(data)); });
+}
+
+/**
+ * @brief Attempts to push an element without blocking.
+ *
+ * @details
+ * GIVEN a producer that must not stall,
+ * WHEN `try_push()` is called,
+ * THEN the element is enqueued only if there is free space; otherwise `data`
+ * is left untouched and the call returns immediately.
+ */
+template <typename Derived, typename T, typename Trace>
+bool LockedQueue<Derived, T, Trace>::try_push(T&& data) {
+    return try_push_with([this, &data] { self().enqueue_locked(std::move(data)); });
+}
+
+/**
+ * @brief Pushes an element, waiting at most `timeout` for free space.
+ *
+ * @details
+ * GIVEN a bounded queue that may be full,
+ * WHEN `push_for()` is called,
+ * THEN the producer waits until a slot is freed, the queue is closed or the
+ * timeout expires, whichever happens first. `data` is only moved from on success.
+ */
+template <typename Derived, typename T, typename Trace>
+template <typename Rep, typename Period>
+bool LockedQueue<Derived, T, Trace>::push_for(
+    T&& data, const std::chrono::duration<Rep, Period>& timeout) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    if (!space_cv.wait_for(lock, timeout, [this] { return closed || !full(); })) return false;
+
+    if (closed) return false;
+
+    self().enqueue_locked(std::move(data));
+    cv.notify_one();
+    return true;
+}
+
+/**
+ * @brief Pushes a range of elements with a single lock acquisition.
+ *
+ * @details
+ * GIVEN a producer holding a burst of elements,
+ * WHEN `push_bulk()` is called,
+ * THEN the whole range is stored under one lock and exactly as many waiting
+ * consumers as new elements are notified (a single `notify_all()` if there are
+ * fewer waiters than elements).
+ *
+ * On a bounded queue, the producer inserts as many elements as fit, wakes the
+ * consumers and waits for more space, until the range is exhausted or the queue
+ * is closed.
+ */
+template <typename Derived, typename T, typename Trace>
+template <typename InputIt>
+std::size_t LockedQueue<Derived, T, Trace>::push_bulk(InputIt first, InputIt last) {
+    std::size_t                  pushed = 0;
+    std::unique_lock<std::mutex> lock(mtx);
+
+    while (first != last) {
+        space_cv.wait(lock, [this] { return closed || !full(); });
+        if (closed) break;
+
+        std::size_t added = 0;
+        for (; first != last && !full(); ++first, ++added) self().enqueue_locked(std::move(*first));
+
+        pushed += added;
+        notify_n(cv, added, waiting_consumers);
+    }
+    return pushed;
+}
+
+/**
+ * @brief Pops the next element, blocking until one becomes available or the queue closes.
+ *
+ * @details
+ * GIVEN one or more consumer threads waiting for tasks,
+ * WHEN the queue is empty, `pop()` blocks the thread until either:
+ * - A producer pushes a new element (`cv.notify_one()`), or
+ * - The queue is closed via `close()`.
+ *
+ * THEN, once unblocked:
+ * - If there is data available, the next element is popped and returned.
+ * - If the queue is closed and empty, the function returns `false`.
+ */
+template <typename Derived, typename T, typename Trace>
+bool LockedQueue<Derived, T, Trace>::pop(T& data) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    ++waiting_consumers;
+    cv.wait(lock, [this] { return closed || self().count_locked() != 0; });
+    --waiting_consumers;
+
+    if (self().count_locked() == 0) return false;
+
+    Trace::trace("[Thread Safe Queue] Task extracted successfully");
+    take_locked(data);
+    return true;
+}
+
+/**
+ * @brief Attempts to pop the next element without blocking.
+ *
+ * @details
+ * GIVEN a queue that may or may not contain elements,
+ * WHEN `try_pop()` is called,
+ * THEN it immediately returns the next element (moved) if available, or `nullopt`
+ * if the queue is empty or has been closed.
+ */
+template <typename Derived, typename T, typename Trace>
+nonstd::optional<T> LockedQueue<Derived, T, Trace>::try_pop() {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (closed || self().count_locked() == 0) {
+        Trace::trace("[Thread Safe Queue] No task extracted");
+        return nonstd::nullopt;
+    }
+
+    Trace::trace("[Thread Safe Queue] Task extracted successfully");
+    T data = self().dequeue_locked();
+    if (max_size != 0) space_cv.notify_one();
+    return data;
+}
+
+/**
+ * @brief Pops the next element, waiting at most `timeout` for one to arrive.
+ *
+ * @details
+ * The timeout is turned into a `steady_clock` deadline, so wall-clock adjustments
+ * do not stretch or shorten the wait.
+ */
+template <typename Derived, typename T, typename Trace>
+template <typename Rep, typename Period>
+PopStatus LockedQueue<Derived, T, Trace>::pop_for(
+    T& data, const std::chrono::duration<Rep, Period>& timeout) {
+    using clock = std::chrono::steady_clock;
+    return pop_until(data, clock::now() + std::chrono::duration_cast<clock::duration>(timeout));
+}
+
+/**
+ * @brief Pops the next element, waiting until `deadline` for one to arrive.
+ *
+ * @details
+ * GIVEN a consumer that must also do periodic work (heartbeats, idle checks),
+ * WHEN `pop_until()` is called on an empty queue,
+ * THEN it sleeps on `cv` like `pop()` but returns `Timeout` once `deadline` passes,
+ * so the consumer never has to poll `try_pop()`.
+ */
+template <typename Derived, typename T, typename Trace>
+template <typename Clock, typename Duration>
+PopStatus LockedQueue<Derived, T, Trace>::pop_until(
+    T& data, const std::chrono::time_point<Clock, Duration>& deadline) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    ++waiting_consumers;
+    const bool ready =
+        cv.wait_until(lock, deadline, [this] { return closed || self().count_locked() != 0; });
+    --waiting_consumers;
+
+    if (!ready) return PopStatus::Timeout;
+    if (self().count_locked() == 0) return PopStatus::Closed;
+
+    Trace::trace("[Thread Safe Queue] Task extracted successfully");
+    take_locked(data);
+    return PopStatus::Item;
+}
+
+/**
+ * @brief Pops up to `max_n` elements, blocking until at least one is available.
+ *
+ * @details
+ * GIVEN a consumer that processes work in batches,
+ * WHEN `pop_bulk()` is called,
+ * THEN it blocks like `pop()` and then drains up to `max_n` elements in the same
+ * critical section, amortizing the lock over the whole batch.
+ */
+template <typename Derived, typename T, typename Trace>
+template <typename OutputIt>
+std::size_t LockedQueue<Derived, T, Trace>::pop_bulk(OutputIt out, std::size_t max_n) {
+    if (max_n == 0) return 0;
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    ++waiting_consumers;
+    cv.wait(lock, [this] { return closed || self().count_locked() != 0; });
+    --waiting_consumers;
+
+    const std::size_t n = drain_locked(out, max_n);
+    if (n != 0) Trace::trace("[Thread Safe Queue] Tasks extracted successfully");
+    return n;
+}
+
+/**
+ * @brief Pops up to `max_n` elements without blocking.
+ *
+ * @note
+ * Like `try_pop()`, nothing is returned once the queue has been closed.
+ */
+template <typename Derived, typename T, typename Trace>
+template <typename OutputIt>
+std::size_t LockedQueue<Derived, T, Trace>::try_pop_bulk(OutputIt out, std::size_t max_n) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (closed) return 0;
+
+    const std::size_t n = drain_locked(out, max_n);
+    if (n != 0) Trace::trace("[Thread Safe Queue] Tasks extracted successfully");
+    return n;
+}
+
+template <typename Derived, typename T, typename Trace>
+bool LockedQueue<Derived, T, Trace>::empty() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return self().count_locked() == 0;
+}
+
+template <typename Derived, typename T, typename Trace>
+std::size_t LockedQueue<Derived, T, Trace>::size() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return self().count_locked();
+}
+
+/**
+ * @brief Returns the configured capacity of the queue.
+ *
+ * @note
+ * The capacity is fixed at construction, so no lock is required.
+ */
+template <typename Derived, typename T, typename Trace>
+std::size_t LockedQueue<Derived, T, Trace>::capacity() const {
+    return max_size;
+}
+
+/**
+ * @brief Removes all elements from the queue and releases blocked producers.
+ */
+template <typename Derived, typename T, typename Trace>
+void LockedQueue<Derived, T, Trace>::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    Trace::trace("[Thread Safe Queue] Tasks cleaned");
+    self().clear_locked();
+    space_cv.notify_all();
+}
+
+/**
+ * @brief Closes the queue and unblocks all waiting threads.
+ *
+ * @details
+ * GIVEN a running queue with potential blocking consumers,
+ * WHEN `close()` is invoked,
+ * THEN:
+ * - Sets the internal `closed` flag to `true`.
+ * - Notifies all threads waiting on `cv.wait()` so they can terminate gracefully.
+ * - Notifies all producers blocked on a full queue so they can give up.
+ *
+ * @note
+ * Safe to call multiple times (idempotent).
+ */
+template <typename Derived, typename T, typename Trace>
+void LockedQueue<Derived, T, Trace>::close() {
+    std::lock_guard<std::mutex> lock(mtx);
+    closed = true;
+    Trace::trace("[Thread Safe Queue] Task queue closed");
+    cv.notify_all();
+    space_cv.notify_all();
+}
+
+/*****************************************************************************/
+
+/* Protected Methods */
+
+/**
+ * @brief Constructs an empty queue with an optional capacity limit.
+ *
+ * @param max_capacity Maximum number of elements, or `0` for an unbounded queue.
+ */
+template <typename Derived, typename T, typename Trace>
+LockedQueue<Derived, T, Trace>::LockedQueue(std::size_t max_capacity) : max_size(max_capacity) {}
+
+template <typename Derived, typename T, typename Trace>
+template <typename Insert>
+bool LockedQueue<Derived, T, Trace>::push_with(Insert&& insert) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // Wait until there is room for the new element
+    space_cv.wait(lock, [this] { return closed || !full(); });
+
+    if (closed) return false;
+
+    insert();
+    cv.notify_one();
+    return true;
+}
+
+template <typename Derived, typename T, typename Trace>
+template <typename Insert>
+bool LockedQueue<Derived, T, Trace>::try_push_with(Insert&& insert) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (closed || full()) return false;
+
+    insert();
+    cv.notify_one();
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Checks whether a bounded queue has reached its capacity.
+ *
+ * @note
+ * The caller must hold `mtx`.
+ */
+template <typename Derived, typename T, typename Trace>
+bool LockedQueue<Derived, T, Trace>::full() const {
+    return max_size != 0 && self().count_locked() >= max_size;
+}
+
+template <typename Derived, typename T, typename Trace>
+void LockedQueue<Derived, T, Trace>::take_locked(T& data) {
+    data = self().dequeue_locked();
+    if (max_size != 0) space_cv.notify_one();
+}
+
+/**
+ * @brief Moves up to `max_n` elements to `out` and releases their slots.
+ *
+ * @note
+ * The caller must hold `mtx`. Blocked producers are woken when the queue is bounded.
+ */
+template <typename Derived, typename T, typename Trace>
+template <typename OutputIt>
+std::size_t LockedQueue<Derived, T, Trace>::drain_locked(OutputIt& out, std::size_t max_n) {
+    std::size_t n = 0;
+    for (; n < max_n && self().count_locked() != 0; ++n) *out++ = self().dequeue_locked();
+
+    if (max_size != 0 && n != 0) space_cv.notify_all();
+    return n;
+}
+
+/*****************************************************************************/
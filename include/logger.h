@@ -11,7 +11,8 @@
  * console logging in concurrent applications.
  *
  * Each message is prefixed with:
- * - A timestamp in ISO-like format (`YYYY-MM-DD HH:MM:SS`)
+ * - A timestamp in ISO-like format (`YYYY-MM-DD HH:MM:SS`), optionally with
+ *   millisecond or microsecond digits (`set_timestamp_precision()`)
  * - The log level (`DBG`, `INFO`, `WARN`, `ERROR`)
  *
  * Internally:
@@ -20,6 +21,18 @@
  * - A static `minLevel` acts as a **filter**: messages below the current
  *   level are ignored.
  *
+ * Filtering happens before any formatting: `minLevel` is an atomic read without
+ * locking, and the variadic `debug()` / `info()` / `warn()` / `error()` overloads and
+ * the `LOG_*` macros only convert their arguments to text once the level is enabled.
+ * Levels below `LOGGER_MIN_LEVEL` are rejected at compile time, which removes
+ * `LOG_DEBUG` calls (arguments included) from release builds.
+ *
+ * In **asynchronous mode** (`start_async()`), callers only push a record (level,
+ * time and message) into a bounded lock-free ring; a background writer thread
+ * formats records and writes them to `std::cout` in batches. `flush()` waits until
+ * everything logged before the call has been written, and an `OverflowPolicy`
+ * decides what happens when the ring is full.
+ *
  * @note
  * The Logger is purely static — no instances should be created.
  * It is designed to be safe for concurrent use across all threads.
@@ -32,8 +45,33 @@
 /*****************************************************************************/
 
 /* Standard libraries */
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <mutex>
+#include <sstream>
 #include <string>
+#include <type_traits>
+
+/*****************************************************************************/
+
+/* Compile-time Level Filter */
+
+/**
+ * @def LOGGER_MIN_LEVEL
+ * @brief Lowest level compiled in (0 = DBG, 1 = INFO, 2 = WARN, 3 = ERROR).
+ *
+ * @details
+ * Defaults to `INFO` when `NDEBUG` is defined and to `DBG` otherwise. Messages below
+ * it are discarded whatever `set_min_level()` says.
+ */
+#ifndef LOGGER_MIN_LEVEL
+#ifdef NDEBUG
+#define LOGGER_MIN_LEVEL 1
+#else
+#define LOGGER_MIN_LEVEL 0
+#endif
+#endif
 
 /*****************************************************************************/
 
@@ -47,13 +85,14 @@
  * - Supports 4 severity levels (`DBG`, `INFO`, `WARN`, `ERROR`).
  * - Global filter level configurable at runtime (`set_min_level()`).
  * - Each line includes timestamp + level + message.
+ * - Messages are built from any number of arguments, only when the level is enabled.
  *
  * ### Usage example:
  * ```cpp
  * Logger::set_min_level(Logger::Level::INFO);
  * Logger::info("Worker started");
- * Logger::warn("Task queue is almost full");
- * Logger::error("Unhandled exception in worker");
+ * Logger::warn("Task queue holds ", queue.size(), " tasks");
+ * LOG_DEBUG("State dump: ", expensive_dump()); // not evaluated unless DBG is enabled
  * ```
  */
 class Logger
@@ -106,64 +145,165 @@ class Logger
      */
     static void set_min_level(Level lvl);
 
+    /**
+     * @enum TimestampPrecision
+     * @brief Sub-second digits appended to the timestamp of each line.
+     */
+    enum class TimestampPrecision
+    {
+        SECONDS,      /**< `YYYY-MM-DD HH:MM:SS` (default). */
+        MILLISECONDS, /**< `YYYY-MM-DD HH:MM:SS.mmm` */
+        MICROSECONDS  /**< `YYYY-MM-DD HH:MM:SS.uuuuuu` */
+    };
+
+    /**
+     * @brief Sets the resolution of the timestamps printed from now on.
+     *
+     * @param precision Sub-second digits to print.
+     *
+     * @details
+     * GIVEN lines logged within the same second,
+     * WHEN the precision is `MILLISECONDS` or `MICROSECONDS`,
+     * THEN they share the cached date/time prefix and only differ in the patched
+     * sub-second digits.
+     */
+    static void set_timestamp_precision(TimestampPrecision precision);
+
     /**@}*/
     /******************************************************************/
     /** @name Logging Methods */
     /**@{*/
 
+    /**
+     * @brief Returns `true` if messages of level `lvl` are currently printed.
+     *
+     * @details
+     * Checks `LOGGER_MIN_LEVEL` (a constant) and then `minLevel` with a relaxed
+     * atomic load; no lock is taken.
+     */
+    static bool is_enabled(Level lvl) noexcept;
+
     /**
      * @brief Logs a debug message (`DBG` level).
-     * @param msg The message to log.
+     * @param args Message pieces, concatenated (strings, characters, numbers, or any
+     *             type with an `operator<<`).
      *
      * @details
      * Only printed if the current `minLevel` is `DBG` or lower.
      * Thread-safe.
      */
-    static void debug(const std::string& msg);
+    template <typename... Args>
+    static void debug(const Args&... args);
 
     /**
      * @brief Logs an informational message (`INFO` level).
-     * @param msg The message to log.
+     * @param args Message pieces, concatenated.
      *
      * @details
      * Commonly used to indicate normal runtime events.
      */
-    static void info(const std::string& msg);
+    template <typename... Args>
+    static void info(const Args&... args);
 
     /**
      * @brief Logs a warning message (`WARN` level).
-     * @param msg The message to log.
+     * @param args Message pieces, concatenated.
      *
      * @details
      * Indicates a non-critical issue or unexpected state.
      */
-    static void warn(const std::string& msg);
+    template <typename... Args>
+    static void warn(const Args&... args);
 
     /**
      * @brief Logs an error message (`ERROR` level).
-     * @param msg The message to log.
+     * @param args Message pieces, concatenated.
      *
      * @details
      * Used for reporting critical failures or exceptions.
      * Typically displayed regardless of the `minLevel` setting,
      * unless the filter is set to `ERROR` itself.
      */
-    static void error(const std::string& msg);
+    template <typename... Args>
+    static void error(const Args&... args);
 
     /**
      * @brief Core logging function that prints a message with explicit severity.
      *
-     * @param lvl Severity level (`DBG`, `INFO`, `WARN`, `ERROR`).
-     * @param msg The message to print.
+     * @param lvl  Severity level (`DBG`, `INFO`, `WARN`, `ERROR`).
+     * @param args Message pieces, concatenated.
      *
      * @details
      * All wrapper methods (`debug()`, `info()`, etc.) call this internally.
-     * This function checks the `minLevel`, then prints a timestamped message.
+     * This function checks the level first and only then converts `args` to text
+     * (in a per-thread buffer) and prints a timestamped message.
      *
      * @note
      * Thread-safe: a global `std::mutex` prevents output interleaving.
      */
-    static void log(Level lvl, const std::string& msg);
+    template <typename... Args>
+    static void log(Level lvl, const Args&... args);
+
+    /**@}*/
+    /******************************************************************/
+    /** @name Asynchronous Mode */
+    /**@{*/
+
+    /**
+     * @enum OverflowPolicy
+     * @brief Behavior of `log()` when the asynchronous ring is full.
+     */
+    enum class OverflowPolicy
+    {
+        BLOCK,      /**< Wait for the writer to free a slot (no record is lost). */
+        DROP,       /**< Discard the record silently. */
+        COUNT_DROPS /**< Discard the record and report the count in the log. */
+    };
+
+    /**
+     * @brief Default number of records the asynchronous ring can hold.
+     */
+    static constexpr std::size_t DEFAULT_ASYNC_CAPACITY = 8192;
+
+    /**
+     * @brief Switches the logger to asynchronous mode.
+     *
+     * @param capacity Ring capacity in records (rounded up to a power of two).
+     * @param policy   What `log()` does when the ring is full.
+     *
+     * @details
+     * GIVEN a logger in synchronous mode,
+     * WHEN `start_async()` is called,
+     * THEN a background writer thread is started and subsequent `log()` calls only
+     * enqueue a record, never touching the console.
+     *
+     * @note
+     * Call it before starting the threads that log; calling it while already in
+     * asynchronous mode has no effect.
+     */
+    static void start_async(std::size_t    capacity = DEFAULT_ASYNC_CAPACITY,
+                            OverflowPolicy policy   = OverflowPolicy::BLOCK);
+
+    /**
+     * @brief Writes every pending record, stops the writer and returns to synchronous mode.
+     *
+     * @details
+     * Records logged concurrently with the shutdown are written synchronously.
+     */
+    static void stop_async();
+
+    /**
+     * @brief Blocks until every record logged before the call has been written.
+     *
+     * @details
+     * In synchronous mode this only flushes `std::cout`.
+     */
+    static void flush();
+
+    /**
+     * @brief Returns the number of records discarded because the ring was full.
+     */
+    static std::size_t dropped_count();
 
     /**@}*/
     /******************************************************************/
@@ -172,19 +312,54 @@ class Logger
 
    private:
     /**
-     * @brief Returns the current timestamp formatted as "YYYY-MM-DD HH:MM:SS".
+     * @brief Prints (or enqueues) an already filtered message.
+     *
+     * @param lvl Severity level.
+     * @param msg Message text.
+     */
+    static void write(Level lvl, const std::string& msg);
+
+    /**
+     * @name Message Builders
+     * @brief Append one message piece to `out`.
+     */
+    /**@{*/
+    static void append(std::string& out, const std::string& value);
+    static void append(std::string& out, const char* value);
+    static void append(std::string& out, char value);
+
+    template <typename T>
+    static typename std::enable_if<std::is_arithmetic<T>::value>::type append(std::string& out,
+                                                                             T            value);
+
+    template <typename T>
+    static typename std::enable_if<!std::is_arithmetic<T>::value>::type append(
+        std::string& out, const T& value);
+    /**@}*/
+
+    /**
+     * @brief Size of the buffer receiving a formatted timestamp.
+     */
+    static constexpr std::size_t TIMESTAMP_BUFFER_SIZE = 32;
+
+    /**
+     * @brief Formats `when` as "YYYY-MM-DD HH:MM:SS[.fraction]" into `out`.
      *
      * @details
-     * Uses `std::chrono::system_clock` and `std::put_time()` for formatting.
+     * The calendar part comes from a per-thread cache that is only rebuilt
+     * (`localtime_r()` + `strftime()`) when the second changes; sub-second digits are
+     * written directly. No heap allocation takes place.
      *
-     * @return String containing the formatted timestamp.
+     * @param when Time to format.
+     * @param out  Buffer of `TIMESTAMP_BUFFER_SIZE` characters (not NUL-terminated).
+     * @return Number of characters written.
      *
      * Example:
      * ```
-     * 2025-10-07 16:30:15
+     * 2025-10-07 16:30:15.123456
      * ```
      */
-    static std::string timestamp();
+    static std::size_t timestamp(std::chrono::system_clock::time_point when, char* out);
 
     /**
      * @brief Converts a `Level` enum value into a short string label.
@@ -194,15 +369,72 @@ class Logger
      */
     static const char* levelToString(Level lvl);
 
+    /**
+     * @brief Appends one formatted log line (terminated by `'\n'`) to `out`.
+     *
+     * @param out  Destination buffer.
+     * @param lvl  Severity level.
+     * @param when Time the message was logged.
+     * @param msg  Message text.
+     */
+    static void format_line(std::string&                          out,
+                            Level                                 lvl,
+                            std::chrono::system_clock::time_point when,
+                            const std::string&                    msg);
+
+    /**
+     * @brief Body of the background writer thread.
+     */
+    static void writer_loop();
+
+    /**
+     * @struct AsyncState
+     * @brief Ring, writer thread and counters of the asynchronous mode (defined in
+     *        `logger.cpp`).
+     */
+    struct AsyncState;
+
+    /**
+     * @brief Returns the process-wide asynchronous state.
+     */
+    static AsyncState& async_state();
+
     /**@}*/
     /******************************************************************/
     /** @name Static Attributes */
     /**@{*/
 
    private:
-    static std::mutex mtx;      /**< Global mutex to serialize console output. */
-    static Level      minLevel; /**< Current minimum severity threshold. */
+    static std::mutex         mtx;      /**< Global mutex to serialize console output. */
+    static std::atomic<Level> minLevel; /**< Current minimum severity threshold. */
+
+    static std::atomic<TimestampPrecision> precision; /**< Sub-second timestamp digits. */
 
     /**@}*/
     /******************************************************************/
 };
+
+/*****************************************************************************/
+
+/* Logging Macros */
+
+/**
+ * @brief Logs `...` at level `lvl`; the arguments are only evaluated if it is enabled.
+ *
+ * @details
+ * The compile-time test comes first, so calls below `LOGGER_MIN_LEVEL` reduce to a
+ * constant-false branch the compiler removes.
+ */
+#define LOGGER_LOG(lvl, ...)                                                      \
+    do                                                                            \
+    {                                                                             \
+        if (static_cast<int>(lvl) >= LOGGER_MIN_LEVEL && Logger::is_enabled(lvl)) \
+            Logger::log(lvl, __VA_ARGS__);                                        \
+    } while (0)
+
+#define LOG_DEBUG(...) LOGGER_LOG(Logger::Level::DBG, __VA_ARGS__)
+#define LOG_INFO(...)  LOGGER_LOG(Logger::Level::INFO, __VA_ARGS__)
+#define LOG_WARN(...)  LOGGER_LOG(Logger::Level::WARN, __VA_ARGS__)
+#define LOG_ERROR(...) LOGGER_LOG(Logger::Level::ERROR, __VA_ARGS__)
+
+#include "logger.ipp"
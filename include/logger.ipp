@@ -0,0 +1,105 @@
+/**
+ * @file        logger.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-06>
+ * @version     1.0.0
+ *
+ * @brief       Inline level check and variadic message building of the Logger.
+ *
+ * @details
+ * Messages are concatenated into a per-thread buffer that is reused across calls, so
+ * a filtered-out call costs one relaxed atomic load and an enabled one only
+ * allocates while the buffer is still growing.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+inline bool Logger::is_enabled(Level lvl) noexcept {
+    return static_cast<int>(lvl) >= LOGGER_MIN_LEVEL &&
+           static_cast<int>(lvl) >= static_cast<int>(minLevel.load(std::memory_order_relaxed));
+}
+
+template <typename... Args>
+void Logger::debug(const Args&... args) {
+    log(Level::DBG, args...);
+}
+
+template <typename... Args>
+void Logger::info(const Args&... args) {
+    log(Level::INFO, args...);
+}
+
+template <typename... Args>
+void Logger::warn(const Args&... args) {
+    log(Level::WARN, args...);
+}
+
+template <typename... Args>
+void Logger::error(const Args&... args) {
+    log(Level::ERROR, args...);
+}
+
+/**
+ * @brief Filters by level, then concatenates `args` and writes the message.
+ *
+ * @details
+ * GIVEN `Logger::info("Starting ", n, " workers")` with `minLevel == WARN`,
+ * WHEN it is called,
+ * THEN it returns after the level check: `n` is never converted and nothing is
+ * allocated or locked.
+ */
+template <typename... Args>
+void Logger::log(Level lvl, const Args&... args) {
+    if (!is_enabled(lvl)) return;
+
+    static thread_local std::string message;
+    message.clear();
+
+    using expand = int[];
+    (void)expand{0, (append(message, args), 0)...};
+
+    write(lvl, message);
+}
+
+/*****************************************************************************/
+
+/* Message Builders */
+
+inline void Logger::append(std::string& out, const std::string& value) {
+    out += value;
+}
+
+inline void Logger::append(std::string& out, const char* value) {
+    out += value;
+}
+
+inline void Logger::append(std::string& out, char value) {
+    out += value;
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type Logger::append(std::string& out,
+                                                                          T            value) {
+    out += std::to_string(value);
+}
+
+/**
+ * @brief Fallback for any other type with an `operator<<` (thread ids, pointers, ...).
+ */
+template <typename T>
+typename std::enable_if<!std::is_arithmetic<T>::value>::type Logger::append(std::string& out,
+                                                                           const T&     value) {
+    std::ostringstream oss;
+    oss << value;
+    out += oss.str();
+}
+
+/*****************************************************************************/
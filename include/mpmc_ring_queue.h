@@ -0,0 +1,388 @@
+/**
+ * @file        mpmc_ring_queue.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-20>
+ * @version     1.0.0
+ *
+ * @brief       Lock-free bounded MPMC ring-buffer backend for ThreadSafeQueue.
+ *
+ * @details
+ * `ThreadSafeQueue<T, MpmcRingBackend>` implements the same interface as the default
+ * mutex-based queue on top of a fixed-capacity ring buffer using Dmitry Vyukov's
+ * bounded MPMC algorithm:
+ *  - The capacity is rounded up to a power of two so slot indices are a simple mask.
+ *  - Every slot carries a sequence number that tells producers and consumers whether
+ *    the slot is free, filled or still being written.
+ *  - Producers and consumers claim slots with a single CAS on `enqueue_pos` /
+ *    `dequeue_pos`, which live on separate cache lines to avoid false sharing.
+ *
+ * Blocking is only a **slow-path fallback**: `push()` and `pop()` spin briefly on the
+ * lock-free fast path and only park on a condition variable when the ring stays full
+ * (or empty). Wake-ups are issued only when a thread is actually parked, so the
+ * uncontended path never touches the mutex.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "queue_backends.h"
+
+/*****************************************************************************/
+
+/**
+ * @class ThreadSafeQueue<T, MpmcRingBackend, Trace>
+ * @brief Lock-free, fixed-capacity FIFO queue for multiple producers and consumers.
+ *
+ * @tparam T     Type of element stored in the queue; must be nothrow move-constructible,
+ *               because a slot is claimed before the element is moved into it and a
+ *               throwing move would leave that slot unpublished, blocking every
+ *               consumer at its position forever.
+ * @tparam Trace Tracing policy for diagnostics (see `queue_trace.h`).
+ *
+ * @note
+ * The queue is always bounded: `push()` blocks while the ring is full,
+ * exactly like a bounded `ThreadSafeQueue<T, MutexBackend>`.
+ */
+template <typename T, typename Trace>
+class ThreadSafeQueue<T, MpmcRingBackend, Trace>
+{
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "MpmcRingBackend elements must be nothrow move-constructible");
+
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Capacity used when none is given to the constructor.
+     */
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty ring with room for at least `min_capacity` elements.
+     *
+     * @param min_capacity Requested capacity; rounded up to the next power of two
+     *                     (minimum 2).
+     */
+    explicit ThreadSafeQueue(std::size_t min_capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Destructor. Destroys any element still stored in the ring.
+     */
+    ~ThreadSafeQueue();
+
+    /**
+     * @brief Disable copy constructor (the ring owns atomics and waiting primitives).
+     */
+    ThreadSafeQueue(const ThreadSafeQueue&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    ThreadSafeQueue& operator=(const ThreadSafeQueue&) = delete;
+
+    /**
+     * @brief Disable move constructor (threads may be spinning on the slots).
+     */
+    ThreadSafeQueue(ThreadSafeQueue&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    ThreadSafeQueue& operator=(ThreadSafeQueue&&) = delete;
+
+    /**
+     * @brief Pushes an element, blocking while the ring is full.
+     *
+     * @param data Rvalue reference to the element being pushed.
+     * @return `true` if the element was enqueued, or `false` if the queue was closed.
+     */
+    bool push(T&& data);
+
+    /**
+     * @brief Attempts to push an element without blocking.
+     *
+     * @param data Rvalue reference to the element being pushed.
+     * @return `true` on success, `false` if the ring is full or closed.
+     *
+     * @details
+     * `data` is only moved from when the call succeeds.
+     */
+    bool try_push(T&& data);
+
+    /**
+     * @brief Pushes an element, waiting at most `timeout` for a free slot.
+     *
+     * @param data    Rvalue reference to the element being pushed.
+     * @param timeout Maximum time to wait while the ring is full.
+     * @return `true` on success, `false` on timeout or if the queue was closed.
+     */
+    template <typename Rep, typename Period>
+    bool push_for(T&& data, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Pushes a range of elements, waking parked consumers once per batch.
+     *
+     * @param first Beginning of the range (elements are moved from).
+     * @param last  End of the range.
+     * @return Number of elements enqueued.
+     */
+    template <typename InputIt>
+    std::size_t push_bulk(InputIt first, InputIt last);
+
+    /**
+     * @brief Pops an element, blocking until one is available or the queue is closed.
+     *
+     * @param[out] data Reference where the popped value will be stored.
+     * @return `true` if an element was retrieved, `false` if the queue is closed and empty.
+     */
+    bool pop(T& data);
+
+    /**
+     * @brief Attempts to pop an element without blocking.
+     *
+     * @return The front element, or `nonstd::nullopt` if the ring is empty or closed.
+     */
+    nonstd::optional<T> try_pop();
+
+    /**
+     * @brief Pops an element, waiting at most `timeout` for one to arrive.
+     *
+     * @return `PopStatus::Item`, `PopStatus::Timeout` or `PopStatus::Closed` (closed and
+     *         drained).
+     */
+    template <typename Rep, typename Period>
+    PopStatus pop_for(T& data, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Pops an element, waiting until `deadline` for one to arrive.
+     *
+     * @return Same as `pop_for()`.
+     */
+    template <typename Clock, typename Duration>
+    PopStatus pop_until(T& data, const std::chrono::time_point<Clock, Duration>& deadline);
+
+    /**
+     * @brief Pops up to `max_n` elements, blocking until at least one is available.
+     *
+     * @return Number of elements popped, or `0` if the queue is closed and empty.
+     */
+    template <typename OutputIt>
+    std::size_t pop_bulk(OutputIt out, std::size_t max_n);
+
+    /**
+     * @brief Pops up to `max_n` elements without blocking.
+     *
+     * @return Number of elements popped (`0` if the ring is empty or closed).
+     */
+    template <typename OutputIt>
+    std::size_t try_pop_bulk(OutputIt out, std::size_t max_n);
+
+    /**
+     * @brief Checks whether the ring is currently empty.
+     *
+     * @return `true` if no element is stored.
+     *
+     * @note
+     * The result is a snapshot and may be stale as soon as it is returned.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the approximate number of stored elements.
+     *
+     * @return Number of claimed slots between the consumer and producer cursors.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the number of slots in the ring.
+     *
+     * @return The power-of-two capacity chosen at construction.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Drains and destroys all elements currently stored in the ring.
+     *
+     * @details
+     * Does not affect the `closed` state.
+     */
+    void clear();
+
+    /**
+     * @brief Closes the queue and wakes every parked producer and consumer.
+     *
+     * @details
+     * After calling this, `pop()` returns `false` (`pop_for()` / `pop_until()` return
+     * `PopStatus::Closed`) once the ring is drained,
+     * `try_pop()` returns `nullopt` and every push is rejected.
+     *
+     * @note
+     * A push that already passed its closed check when `close()` runs may still land
+     * in the ring; such elements are released by `clear()` or the destructor.
+     */
+    void close();
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @struct Cell
+     * @brief Ring slot: a sequence number plus raw storage for one element.
+     *
+     * @details
+     * For a slot at position `pos`:
+     * - `sequence == pos`     → free, a producer may write it.
+     * - `sequence == pos + 1` → filled, a consumer may read it.
+     */
+    struct Cell
+    {
+        std::atomic<std::size_t>                                   sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+   private:
+    /**
+     * @brief Fast-path attempts made before parking on a condition variable.
+     */
+    static constexpr int SPIN_LIMIT = 64;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Rounds `n` up to the next power of two (minimum 2).
+     */
+    static std::size_t round_up_pow2(std::size_t n);
+
+    /**
+     * @brief Lock-free enqueue attempt; moves from `data` only on success.
+     */
+    bool enqueue(T& data);
+
+    /**
+     * @brief Lock-free dequeue attempt.
+     */
+    nonstd::optional<T> dequeue();
+
+    /**
+     * @brief Dequeues up to `max_n` elements into `out`; returns how many were written.
+     */
+    template <typename OutputIt>
+    std::size_t drain(OutputIt& out, std::size_t max_n);
+
+    /**
+     * @brief Returns `true` if the slot at the consumer cursor may hold data.
+     */
+    bool readable() const;
+
+    /**
+     * @brief Returns `true` if the slot at the producer cursor may be free.
+     */
+    bool writable() const;
+
+    /**
+     * @brief Wakes up to `n` parked consumers, if any, after elements were published.
+     */
+    void wake_consumers(std::size_t n);
+
+    /**
+     * @brief Wakes up to `n` parked producers after slots were released, plus one parked
+     *        consumer if the next slot is already readable.
+     */
+    void wake_after_dequeue(std::size_t n);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Index mask (`capacity - 1`).
+     */
+    const std::size_t mask;
+
+    /**
+     * @brief Slot array of `mask + 1` cells.
+     */
+    std::unique_ptr<Cell[]> cells;
+
+    /**
+     * @brief Producer cursor, alone on its cache line.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueue_pos;
+
+    /**
+     * @brief Consumer cursor, alone on its cache line.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeue_pos;
+
+    /**
+     * @brief Graceful shutdown flag.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> closed;
+
+    /**
+     * @brief Number of consumers parked on `data_cv`.
+     */
+    std::atomic<int> waiting_consumers;
+
+    /**
+     * @brief Number of producers parked on `space_cv`.
+     */
+    std::atomic<int> waiting_producers;
+
+    /**
+     * @brief Mutex used only by the blocking slow path.
+     */
+    std::mutex wait_mtx;
+
+    /**
+     * @brief Signals parked consumers that data was published.
+     */
+    std::condition_variable data_cv;
+
+    /**
+     * @brief Signals parked producers that a slot was released.
+     */
+    std::condition_variable space_cv;
+
+    /******************************************************************/
+};
+
+#include "mpmc_ring_queue.ipp"
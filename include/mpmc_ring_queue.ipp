@@ -0,0 +1,577 @@
+/**
+ * @file        mpmc_ring_queue.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-20>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the lock-free MPMC ring-buffer queue backend.
+ *
+ * @details
+ * The fast path (`enqueue()` / `dequeue()`) only uses atomics. The slow path parks
+ * threads on `data_cv` / `space_cv`; the waiter counters together with sequentially
+ * consistent fences guarantee that a thread which parks is always woken by the next
+ * publisher, while publishers skip the mutex when nobody waits. A consumer wake-up
+ * spent on a slot that is claimed but not yet written is passed on by the consumer
+ * that eventually takes that slot (see `wake_after_dequeue()`), so none is lost.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/* Project libraries */
+
+#include "mpmc_ring_queue.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Allocates the ring and initializes every slot as free.
+ *
+ * @param min_capacity Requested capacity, rounded up to a power of two.
+ */
+template <typename T, typename Trace>
+ThreadSafeQueue<T, MpmcRingBackend, Trace>::ThreadSafeQueue(std::size_t min_capacity)
+    : mask(round_up_pow2(min_capacity) - 1),
+      cells(new Cell[mask + 1]),
+      enqueue_pos(0),
+      dequeue_pos(0),
+      closed(false),
+      waiting_consumers(0),
+      waiting_producers(0) {
+    for (std::size_t i = 0; i <= mask; ++i) cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destroys any element left in the ring.
+ */
+template <typename T, typename Trace>
+ThreadSafeQueue<T, MpmcRingBackend, Trace>::~ThreadSafeQueue() {
+    while (dequeue()) {
+    }
+}
+
+/**
+ * @brief Pushes an element, parking the producer while the ring is full.
+ *
+ * @param data Rvalue reference to the element to be enqueued.
+ * @return `true` if the element was enqueued, `false` if the queue was closed.
+ *
+ * @details
+ * GIVEN a producer thread,
+ * WHEN `push()` is called,
+ * THEN it retries the lock-free enqueue up to `SPIN_LIMIT` times and only then
+ * parks on `space_cv` until a consumer frees a slot or the queue is closed.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::push(T&& data) {
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            if (closed.load(std::memory_order_acquire)) return false;
+            if (enqueue(data)) {
+                wake_consumers(1);
+                return true;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_producers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        space_cv.wait(lock,
+                      [this] { return closed.load(std::memory_order_acquire) || writable(); });
+        waiting_producers.fetch_sub(1);
+    }
+}
+
+/**
+ * @brief Attempts a single lock-free enqueue.
+ *
+ * @param data Rvalue reference to the element to be enqueued.
+ * @return `true` on success, `false` if the ring is full or closed.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::try_push(T&& data) {
+    if (closed.load(std::memory_order_acquire) || !enqueue(data)) return false;
+
+    wake_consumers(1);
+    return true;
+}
+
+/**
+ * @brief Pushes an element, waiting at most `timeout` for a free slot.
+ *
+ * @param data    Rvalue reference to the element to be enqueued.
+ * @param timeout Maximum time to wait while the ring is full.
+ * @return `true` on success, `false` on timeout or closure.
+ */
+template <typename T, typename Trace>
+template <typename Rep, typename Period>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::push_for(
+    T&& data, const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            if (closed.load(std::memory_order_acquire)) return false;
+            if (enqueue(data)) {
+                wake_consumers(1);
+                return true;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_producers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool ready = space_cv.wait_until(lock, deadline, [this] {
+            return closed.load(std::memory_order_acquire) || writable();
+        });
+        waiting_producers.fetch_sub(1);
+
+        if (!ready) return false;
+    }
+}
+
+/**
+ * @brief Pushes a range of elements, issuing a single wake-up for the whole batch.
+ *
+ * @param first Beginning of the range (elements are moved from).
+ * @param last  End of the range.
+ * @return Number of elements enqueued (less than the range size only if the queue
+ *         was closed).
+ *
+ * @details
+ * Elements are published with the lock-free fast path one after another; parked
+ * consumers are notified once per batch instead of once per element. When the ring
+ * fills up, the pending batch is announced and the producer falls back to `push()`.
+ */
+template <typename T, typename Trace>
+template <typename InputIt>
+std::size_t ThreadSafeQueue<T, MpmcRingBackend, Trace>::push_bulk(InputIt first, InputIt last) {
+    std::size_t pushed = 0;
+    std::size_t batch  = 0;
+
+    for (; first != last; ++first) {
+        if (closed.load(std::memory_order_acquire)) break;
+
+        auto&& item = *first;
+        if (enqueue(item)) {
+            ++batch;
+        } else {
+            wake_consumers(batch);
+            batch = 0;
+            if (!push(std::move(item))) break;
+        }
+        ++pushed;
+    }
+
+    wake_consumers(batch);
+    return pushed;
+}
+
+/**
+ * @brief Pops an element, parking the consumer while the ring is empty.
+ *
+ * @param[out] data Reference where the extracted element will be stored.
+ * @return `true` if an element was retrieved, `false` if the queue is closed and drained.
+ *
+ * @details
+ * GIVEN one or more consumer threads,
+ * WHEN the ring is empty, `pop()` spins briefly and then parks on `data_cv`
+ * until a producer publishes an element or the queue is closed.
+ *
+ * Elements still stored when the queue is closed are drained before `false`
+ * is returned, mirroring the mutex backend.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::pop(T& data) {
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            const bool was_closed = closed.load(std::memory_order_acquire);
+
+            nonstd::optional<T> item = dequeue();
+            if (item) {
+                data = std::move(*item);
+                wake_after_dequeue(1);
+                return true;
+            }
+
+            if (was_closed) return false;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_consumers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        data_cv.wait(lock, [this] { return closed.load(std::memory_order_acquire) || readable(); });
+        waiting_consumers.fetch_sub(1);
+    }
+}
+
+/**
+ * @brief Attempts a single lock-free dequeue.
+ *
+ * @return The front element, or `nonstd::nullopt` if the ring is empty or closed.
+ */
+template <typename T, typename Trace>
+nonstd::optional<T> ThreadSafeQueue<T, MpmcRingBackend, Trace>::try_pop() {
+    if (closed.load(std::memory_order_acquire)) return nonstd::nullopt;
+
+    nonstd::optional<T> item = dequeue();
+    if (item) wake_after_dequeue(1);
+    return item;
+}
+
+/**
+ * @brief Pops an element, waiting at most `timeout` for one to arrive.
+ */
+template <typename T, typename Trace>
+template <typename Rep, typename Period>
+PopStatus ThreadSafeQueue<T, MpmcRingBackend, Trace>::pop_for(
+    T& data, const std::chrono::duration<Rep, Period>& timeout) {
+    using clock = std::chrono::steady_clock;
+    return pop_until(data, clock::now() + std::chrono::duration_cast<clock::duration>(timeout));
+}
+
+/**
+ * @brief Pops an element, parking the consumer at most until `deadline`.
+ *
+ * @param[out] data     Reference where the extracted element will be stored.
+ * @param      deadline Point in time after which the call gives up.
+ * @return `PopStatus::Item`, `PopStatus::Timeout` or `PopStatus::Closed`.
+ *
+ * @details
+ * Same spin-then-park protocol as `pop()`; the park is a `wait_until()` on `data_cv`,
+ * so an idle consumer sleeps until a producer wakes it or the deadline passes.
+ */
+template <typename T, typename Trace>
+template <typename Clock, typename Duration>
+PopStatus ThreadSafeQueue<T, MpmcRingBackend, Trace>::pop_until(
+    T& data, const std::chrono::time_point<Clock, Duration>& deadline) {
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            const bool was_closed = closed.load(std::memory_order_acquire);
+
+            nonstd::optional<T> item = dequeue();
+            if (item) {
+                data = std::move(*item);
+                wake_after_dequeue(1);
+                return PopStatus::Item;
+            }
+
+            if (was_closed) return PopStatus::Closed;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_consumers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool ready = data_cv.wait_until(lock, deadline, [this] {
+            return closed.load(std::memory_order_acquire) || readable();
+        });
+        waiting_consumers.fetch_sub(1);
+
+        if (!ready) return PopStatus::Timeout;
+    }
+}
+
+/**
+ * @brief Pops up to `max_n` elements, parking until at least one is available.
+ *
+ * @param out   Output iterator receiving the elements in FIFO order.
+ * @param max_n Maximum number of elements to extract.
+ * @return Number of elements extracted, or `0` if the queue is closed and drained.
+ */
+template <typename T, typename Trace>
+template <typename OutputIt>
+std::size_t ThreadSafeQueue<T, MpmcRingBackend, Trace>::pop_bulk(OutputIt out, std::size_t max_n) {
+    if (max_n == 0) return 0;
+
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            const bool was_closed = closed.load(std::memory_order_acquire);
+
+            const std::size_t n = drain(out, max_n);
+            if (n != 0) {
+                wake_after_dequeue(n);
+                return n;
+            }
+
+            if (was_closed) return 0;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_consumers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        data_cv.wait(lock, [this] { return closed.load(std::memory_order_acquire) || readable(); });
+        waiting_consumers.fetch_sub(1);
+    }
+}
+
+/**
+ * @brief Pops up to `max_n` elements without blocking.
+ *
+ * @param out   Output iterator receiving the elements in FIFO order.
+ * @param max_n Maximum number of elements to extract.
+ * @return Number of elements extracted (`0` if the ring is empty or closed).
+ */
+template <typename T, typename Trace>
+template <typename OutputIt>
+std::size_t ThreadSafeQueue<T, MpmcRingBackend, Trace>::try_pop_bulk(OutputIt    out,
+                                                                  std::size_t max_n) {
+    if (closed.load(std::memory_order_acquire)) return 0;
+
+    const std::size_t n = drain(out, max_n);
+    wake_after_dequeue(n);
+    return n;
+}
+
+/**
+ * @brief Checks whether the ring is empty.
+ *
+ * @return `true` if no element is stored at the time of the call.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::empty() const {
+    return size() == 0;
+}
+
+/**
+ * @brief Returns the approximate number of stored elements.
+ *
+ * @return Distance between the producer and consumer cursors, clamped to the capacity.
+ *
+ * @note
+ * The consumer cursor is read first so the result never underflows.
+ */
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, MpmcRingBackend, Trace>::size() const {
+    const std::size_t head = dequeue_pos.load(std::memory_order_acquire);
+    const std::size_t tail = enqueue_pos.load(std::memory_order_acquire);
+
+    if (tail <= head) return 0;
+    return (tail - head) > mask ? mask + 1 : tail - head;
+}
+
+/**
+ * @brief Returns the power-of-two capacity of the ring.
+ */
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, MpmcRingBackend, Trace>::capacity() const {
+    return mask + 1;
+}
+
+/**
+ * @brief Drains and destroys all stored elements.
+ *
+ * @details
+ * Producers parked on a full ring are woken once the slots are released.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, MpmcRingBackend, Trace>::clear() {
+    while (dequeue()) {
+    }
+    Trace::trace("[Thread Safe Queue] Tasks cleaned");
+
+    std::lock_guard<std::mutex> lock(wait_mtx);
+    space_cv.notify_all();
+}
+
+/**
+ * @brief Closes the queue and wakes every parked thread.
+ *
+ * @details
+ * The flag is published before taking `wait_mtx`, so a thread that is about to
+ * park either observes it in its wait predicate or receives the notification.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, MpmcRingBackend, Trace>::close() {
+    closed.store(true, std::memory_order_release);
+    Trace::trace("[Thread Safe Queue] Task queue closed");
+
+    std::lock_guard<std::mutex> lock(wait_mtx);
+    data_cv.notify_all();
+    space_cv.notify_all();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Rounds `n` up to the next power of two, with a minimum of 2.
+ */
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, MpmcRingBackend, Trace>::round_up_pow2(std::size_t n) {
+    std::size_t capacity = 2;
+    while (capacity < n) capacity <<= 1;
+    return capacity;
+}
+
+/**
+ * @brief Claims the slot at the producer cursor and publishes `data` into it.
+ *
+ * @param data Element to move into the ring (left untouched on failure).
+ * @return `true` on success, `false` if the ring is full.
+ *
+ * @details
+ * A slot is writable when its sequence equals the cursor position. A smaller
+ * sequence means the consumer of the previous lap has not released it yet (full);
+ * a larger one means another producer already claimed it, so the cursor is reloaded.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::enqueue(T& data) {
+    Cell*       cell;
+    std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        cell                   = &cells[pos & mask];
+        const std::size_t seq  = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t    diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    new (&cell->storage) T(std::move(data));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Claims the slot at the consumer cursor and moves its element out.
+ *
+ * @return The extracted element, or `nonstd::nullopt` if the ring is empty.
+ *
+ * @details
+ * After extraction the slot sequence is advanced by one full lap
+ * (`pos + capacity`) so producers can reuse it.
+ */
+template <typename T, typename Trace>
+nonstd::optional<T> ThreadSafeQueue<T, MpmcRingBackend, Trace>::dequeue() {
+    Cell*       cell;
+    std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        cell                   = &cells[pos & mask];
+        const std::size_t seq  = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t    diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0) {
+            if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return nonstd::nullopt;
+        } else {
+            pos = dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    T*                  slot = reinterpret_cast<T*>(&cell->storage);
+    nonstd::optional<T> item(std::move(*slot));
+    slot->~T();
+    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    return item;
+}
+
+/**
+ * @brief Dequeues up to `max_n` elements into `out`.
+ *
+ * @return Number of elements written.
+ */
+template <typename T, typename Trace>
+template <typename OutputIt>
+std::size_t ThreadSafeQueue<T, MpmcRingBackend, Trace>::drain(OutputIt& out, std::size_t max_n) {
+    std::size_t n = 0;
+    for (; n < max_n; ++n) {
+        nonstd::optional<T> item = dequeue();
+        if (!item) break;
+        *out++ = std::move(*item);
+    }
+    return n;
+}
+
+/**
+ * @brief Checks whether the slot at the consumer cursor may contain data.
+ *
+ * @details
+ * Used as the `data_cv` wait predicate. A false positive only causes a retry;
+ * a false negative is impossible because producers notify after publishing.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::readable() const {
+    const std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    const std::size_t seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+    return static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) >= 0;
+}
+
+/**
+ * @brief Checks whether the slot at the producer cursor may be free.
+ *
+ * @details
+ * Used as the `space_cv` wait predicate, with the same tolerance as `readable()`.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, MpmcRingBackend, Trace>::writable() const {
+    const std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    const std::size_t seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+    return static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) >= 0;
+}
+
+/**
+ * @brief Notifies up to `n` parked consumers, taking the mutex only if one is waiting.
+ *
+ * @param n Number of elements just published.
+ *
+ * @details
+ * The fence pairs with the one issued by a consumer after incrementing
+ * `waiting_consumers`: either the consumer sees the published slot in its
+ * predicate, or this thread sees the consumer in the counter.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, MpmcRingBackend, Trace>::wake_consumers(std::size_t n) {
+    if (n == 0) return;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int waiting = waiting_consumers.load(std::memory_order_relaxed);
+    if (waiting == 0) return;
+
+    std::lock_guard<std::mutex> lock(wait_mtx);
+    notify_n(data_cv, n, static_cast<std::size_t>(waiting));
+}
+
+/**
+ * @brief Notifies parked producers of the released slots and passes a consumer wake-up
+ *        along, taking the mutex only if somebody is waiting.
+ *
+ * @param n Number of slots just released.
+ *
+ * @details
+ * `readable()` only inspects the slot at the consumer cursor, so a consumer woken for
+ * slot `k + 1` while slot `k` is claimed but not yet written goes back to sleep and
+ * the notification is spent. The consumer that later takes slot `k` therefore checks
+ * whether the next slot is ready and, if consumers are still parked, wakes one of
+ * them: every published element is eventually seen by a parked consumer.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, MpmcRingBackend, Trace>::wake_after_dequeue(std::size_t n) {
+    if (n == 0) return;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int  producers = waiting_producers.load(std::memory_order_relaxed);
+    const bool more = waiting_consumers.load(std::memory_order_relaxed) != 0 && readable();
+    if (producers == 0 && !more) return;
+
+    std::lock_guard<std::mutex> lock(wait_mtx);
+    if (producers != 0) notify_n(space_cv, n, static_cast<std::size_t>(producers));
+    if (more) data_cv.notify_one();
+}
+
+/*****************************************************************************/
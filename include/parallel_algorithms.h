@@ -0,0 +1,226 @@
+/**
+ * @file        parallel_algorithms.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-12>
+ * @version     1.0.0
+ *
+ * @brief       Data-parallel loops (`parallel_for`, `parallel_reduce`) on a WorkerPool.
+ *
+ * @details
+ * Both algorithms split an `IndexRange` recursively in halves:
+ *  - the thread processing a range keeps the left half and publishes the right half
+ *    in a job-local list, submitting one helper task per published half;
+ *  - helpers (pool workers) and the calling thread take published halves, split them
+ *    further and run the body on the leaves;
+ *  - the caller never blocks while a published range is left, so calling from inside a
+ *    pool task (nested parallelism) cannot deadlock, even on a one-worker pool.
+ *
+ * With an explicit `grain`, ranges are split until they are at most `grain` long.
+ * With `AUTO_GRAIN`, splitting is **lazy**: a range is only split while fewer halves
+ * are waiting than there are workers to take them, down to a floor of about eight
+ * leaves per participant. Busy pools thus get few large leaves, and idle workers make
+ * the leaves smaller where the load is uneven.
+ *
+ * Example:
+ * ```cpp
+ * parallel_for(pool, IndexRange{0, pixels.size()}, AUTO_GRAIN, [&](IndexRange r) {
+ *     for (std::size_t i = r.begin; i < r.end; i++) pixels[i] = shade(i);
+ * });
+ *
+ * double total = parallel_reduce(pool, IndexRange{0, v.size()}, 0.0,
+ *     [&](IndexRange r, double acc) {
+ *         for (std::size_t i = r.begin; i < r.end; i++) acc += v[i];
+ *         return acc;
+ *     },
+ *     [](double a, double b) { return a + b; });
+ * ```
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+/* Project libraries */
+
+#include "worker_pool.h"
+
+/*****************************************************************************/
+
+/**
+ * @brief Requests automatic grain-size selection.
+ */
+constexpr std::size_t AUTO_GRAIN = 0;
+
+/**
+ * @struct IndexRange
+ * @brief Half-open range of indices `[begin, end)`.
+ */
+struct IndexRange
+{
+    std::size_t begin; /**< First index. */
+    std::size_t end;   /**< One past the last index. */
+
+    /**
+     * @brief Number of indices in the range.
+     */
+    std::size_t size() const { return end > begin ? end - begin : 0; }
+
+    /**
+     * @brief Returns `true` if the range holds no index.
+     */
+    bool empty() const { return end <= begin; }
+};
+
+/**
+ * @class ParallelJob
+ * @brief Shared state of one `parallel_for` / `parallel_reduce` call.
+ *
+ * @tparam Leaf Callable run on every leaf range.
+ *
+ * @details
+ * Internal to the algorithms below. Helper tasks keep the job alive through a
+ * `shared_ptr`, so a helper that only runs after the call has returned finds an empty
+ * list and exits without touching `leaf`.
+ */
+template <typename Leaf>
+class ParallelJob
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Prepares a job over `range` that will run `leaf` on each leaf.
+     *
+     * @param pool  Pool running the helper tasks.
+     * @param leaf  Callable invoked as `leaf(IndexRange)`.
+     * @param range Whole range (only used to derive the automatic grain).
+     * @param grain Largest leaf size, or `AUTO_GRAIN`.
+     */
+    ParallelJob(WorkerPool& pool, Leaf leaf, IndexRange range, std::size_t grain);
+
+    /**
+     * @brief Processes `range` on the calling thread and helps until the job is done.
+     *
+     * @details
+     * Rethrows the first exception thrown by `leaf`; once a leaf has thrown, the
+     * remaining ranges are discarded.
+     */
+    static void run(const std::shared_ptr<ParallelJob>& job, IndexRange range);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Body of a helper task: processes published ranges until none is left.
+     */
+    static void help(const std::shared_ptr<ParallelJob>& job);
+
+    /**
+     * @brief Takes the oldest (largest) published range.
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    bool take_locked(IndexRange& range);
+
+    /**
+     * @brief Splits `range` as long as allowed, then runs `leaf` on what is left.
+     */
+    static void process(const std::shared_ptr<ParallelJob>& job, IndexRange range);
+
+    /**
+     * @brief Returns `true` if `range` should be split once more.
+     */
+    bool should_split(const IndexRange& range) const;
+
+    /**
+     * @brief Publishes `range` and submits a helper task for it.
+     */
+    static void publish(const std::shared_ptr<ParallelJob>& job, IndexRange range);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    WorkerPool&       pool;    /**< Pool running the helper tasks. */
+    Leaf              leaf;    /**< Per-leaf callable. */
+    const std::size_t workers; /**< Pool workers when the job started. */
+    const bool        lazy;    /**< `true` for `AUTO_GRAIN` (demand-driven splitting). */
+    std::size_t       grain;   /**< Ranges of at most this size are never split. */
+
+    std::mutex              mtx;             /**< Protects the attributes below. */
+    std::condition_variable cv;              /**< Wakes the caller for new ranges or the end. */
+    std::deque<IndexRange>  published;       /**< Ranges waiting for a thread. */
+    std::size_t             active  = 0;     /**< Ranges being processed. */
+    bool                    waiting = false; /**< The caller sleeps on `cv`. */
+    std::exception_ptr      error;           /**< First exception thrown by `leaf`. */
+
+    std::atomic<std::size_t> queued{0};     /**< `published.size()`, readable without lock. */
+    std::atomic<bool>        failed{false}; /**< Set once `error` is stored. */
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @brief Runs `body` over `range`, split across the pool and the calling thread.
+ *
+ * @param pool  Pool providing the helper threads.
+ * @param range Indices to process.
+ * @param grain Largest leaf handed to `body`, or `AUTO_GRAIN`.
+ * @param body  Called as `body(IndexRange)` on disjoint sub-ranges covering `range`.
+ *
+ * @details
+ * GIVEN a pool of `N` workers and a range of `n` indices,
+ * WHEN `parallel_for()` is called,
+ * THEN every index is passed to `body` exactly once, up to `N + 1` threads (the pool's
+ * and the caller's) run `body` concurrently, and the call returns once all leaves
+ * have returned.
+ *
+ * @note
+ * `body` must be safe to call concurrently on disjoint ranges. The first exception it
+ * throws is rethrown here after the leaves already running have finished. With no
+ * started worker, `body(range)` simply runs on the caller.
+ */
+template <typename Body>
+void parallel_for(WorkerPool& pool, IndexRange range, std::size_t grain, const Body& body);
+
+/**
+ * @brief Reduces `range` in parallel.
+ *
+ * @param pool     Pool providing the helper threads.
+ * @param range    Indices to process.
+ * @param identity Neutral element of `combine`; every leaf starts from a copy.
+ * @param body     Called as `body(IndexRange, T acc)`, returns `acc` updated with the leaf.
+ * @param combine  Associative `T combine(T left, T right)`.
+ * @param grain    Largest leaf handed to `body`, or `AUTO_GRAIN`.
+ * @return `identity` combined with every leaf result, in index order.
+ *
+ * @details
+ * Leaf results are combined in ascending index order, so `combine` needs to be
+ * associative but not commutative (string concatenation works).
+ */
+template <typename T, typename Body, typename Combine>
+T parallel_reduce(WorkerPool& pool, IndexRange range, T identity, const Body& body,
+                  const Combine& combine, std::size_t grain = AUTO_GRAIN);
+
+#include "parallel_algorithms.ipp"
@@ -0,0 +1,220 @@
+/**
+ * @file        parallel_algorithms.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-12>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of ParallelJob, parallel_for and parallel_reduce.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/* Project libraries */
+
+#include "parallel_algorithms.h"
+
+/*****************************************************************************/
+
+/* ParallelJob */
+
+/**
+ * @brief Fixes the grain: at least 1, or about eight leaves per participant when automatic.
+ */
+template <typename Leaf>
+ParallelJob<Leaf>::ParallelJob(WorkerPool& pool, Leaf leaf, IndexRange range, std::size_t grain)
+    : pool(pool),
+      leaf(std::move(leaf)),
+      workers(pool.worker_count()),
+      lazy(grain == AUTO_GRAIN),
+      grain(grain) {
+    if (lazy)
+        this->grain = range.size() / (8 * (workers + 1));
+    this->grain = std::max<std::size_t>(1, this->grain);
+}
+
+/**
+ * @brief Runs the caller's share of the job.
+ *
+ * @details
+ * GIVEN the whole range on the calling thread,
+ * WHEN it has processed its own left-most part,
+ * THEN it takes published ranges while there are any and only sleeps when every
+ * remaining range is already being processed by a helper; it returns once none is.
+ */
+template <typename Leaf>
+void ParallelJob<Leaf>::run(const std::shared_ptr<ParallelJob>& job, IndexRange range) {
+    {
+        std::lock_guard<std::mutex> lock(job->mtx);
+        job->active++;
+    }
+    process(job, range);
+
+    std::unique_lock<std::mutex> lock(job->mtx);
+    for (;;) {
+        IndexRange next;
+        if (job->take_locked(next)) {
+            lock.unlock();
+            process(job, next);
+            lock.lock();
+            continue;
+        }
+        if (job->active == 0)
+            break;
+
+        job->waiting = true;
+        job->cv.wait(lock);
+        job->waiting = false;
+    }
+
+    if (job->error)
+        std::rethrow_exception(job->error);
+}
+
+template <typename Leaf>
+void ParallelJob<Leaf>::help(const std::shared_ptr<ParallelJob>& job) {
+    std::unique_lock<std::mutex> lock(job->mtx);
+    IndexRange                   next;
+    while (job->take_locked(next)) {
+        lock.unlock();
+        process(job, next);
+        lock.lock();
+    }
+}
+
+template <typename Leaf>
+bool ParallelJob<Leaf>::take_locked(IndexRange& range) {
+    if (published.empty())
+        return false;
+
+    range = published.front();
+    published.pop_front();
+    queued.fetch_sub(1, std::memory_order_relaxed);
+    active++;
+    return true;
+}
+
+/**
+ * @brief Splits, runs the leaf and reports completion.
+ *
+ * @details
+ * The left half is kept and split again, so a range turns into one leaf on this
+ * thread plus a logarithmic number of published right halves. After a failure the
+ * leaf is skipped, which drains the remaining ranges quickly.
+ */
+template <typename Leaf>
+void ParallelJob<Leaf>::process(const std::shared_ptr<ParallelJob>& job, IndexRange range) {
+    while (!job->failed.load(std::memory_order_relaxed) && job->should_split(range)) {
+        const std::size_t middle = range.begin + range.size() / 2;
+        publish(job, IndexRange{middle, range.end});
+        range.end = middle;
+    }
+
+    if (!job->failed.load(std::memory_order_relaxed)) {
+        try {
+            job->leaf(range);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job->mtx);
+            if (!job->error)
+                job->error = std::current_exception();
+            job->failed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(job->mtx);
+    job->active--;
+    if (job->active == 0 && job->waiting)
+        job->cv.notify_one();
+}
+
+/**
+ * @brief Applies the grain and, in lazy mode, the demand test.
+ *
+ * @details
+ * GIVEN a lazy job on a pool of 4 workers,
+ * WHEN 4 published ranges are still waiting,
+ * THEN no worker is idle enough to need another one and the range is not split.
+ */
+template <typename Leaf>
+bool ParallelJob<Leaf>::should_split(const IndexRange& range) const {
+    if (range.size() <= grain)
+        return false;
+    return !lazy || queued.load(std::memory_order_relaxed) < workers;
+}
+
+template <typename Leaf>
+void ParallelJob<Leaf>::publish(const std::shared_ptr<ParallelJob>& job, IndexRange range) {
+    {
+        std::lock_guard<std::mutex> lock(job->mtx);
+        job->published.push_back(range);
+        job->queued.fetch_add(1, std::memory_order_relaxed);
+        if (job->waiting)
+            job->cv.notify_one();
+    }
+
+    std::shared_ptr<ParallelJob> shared = job;
+    job->pool.submit(Task([shared] { help(shared); }));
+}
+
+/*****************************************************************************/
+
+/* Algorithms */
+
+template <typename Body>
+void parallel_for(WorkerPool& pool, IndexRange range, std::size_t grain, const Body& body) {
+    if (range.empty())
+        return;
+    if (pool.worker_count() == 0) {
+        body(range);
+        return;
+    }
+
+    auto leaf = [&body](IndexRange leaf_range) { body(leaf_range); };
+    auto job  = std::make_shared<ParallelJob<decltype(leaf)>>(pool, leaf, range, grain);
+    ParallelJob<decltype(leaf)>::run(job, range);
+}
+
+/**
+ * @brief Collects one partial result per leaf, then folds them in index order.
+ *
+ * @details
+ * Lazy splitting keeps the number of leaves close to the number of threads that took
+ * part, so the final sequential fold is short.
+ */
+template <typename T, typename Body, typename Combine>
+T parallel_reduce(WorkerPool& pool, IndexRange range, T identity, const Body& body,
+                  const Combine& combine, std::size_t grain) {
+    if (range.empty())
+        return identity;
+    if (pool.worker_count() == 0)
+        return combine(identity, body(range, T(identity)));
+
+    std::mutex                              partial_mtx;
+    std::vector<std::pair<std::size_t, T>> partials;
+
+    auto leaf = [&](IndexRange leaf_range) {
+        T value = body(leaf_range, T(identity));
+
+        std::lock_guard<std::mutex> lock(partial_mtx);
+        partials.emplace_back(leaf_range.begin, std::move(value));
+    };
+    auto job = std::make_shared<ParallelJob<decltype(leaf)>>(pool, leaf, range, grain);
+    ParallelJob<decltype(leaf)>::run(job, range);
+
+    std::sort(partials.begin(), partials.end(),
+              [](const std::pair<std::size_t, T>& a, const std::pair<std::size_t, T>& b) {
+                  return a.first < b.first;
+              });
+
+    T result = std::move(identity);
+    for (auto& partial : partials)
+        result = combine(std::move(result), std::move(partial.second));
+    return result;
+}
+
+/*****************************************************************************/
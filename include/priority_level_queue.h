@@ -0,0 +1,209 @@
+/**
+ * @file        priority_level_queue.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-09>
+ * @version     1.0.0
+ *
+ * @brief       Multi-level priority backend for ThreadSafeQueue.
+ *
+ * @details
+ * `ThreadSafeQueue<T, PriorityBackend>` keeps one FIFO (`std::deque`) per `Priority`
+ * level and a bitmap with one bit per non-empty level:
+ *  - `push(data, priority)` appends to the level's FIFO and sets its bit, O(1);
+ *  - `pop()` serves the highest set bit, O(1), so elements of the same level keep
+ *    their FIFO order and a burst of `Low` work never delays a `High` element.
+ *
+ * Strict priorities can starve the lower levels. When constructed with a non-zero
+ * `aging` interval, an element gains one level for every `aging` it has waited, and
+ * `pop()` compares the fronts of the (at most `PRIORITY_LEVELS`) non-empty levels
+ * by their aged level instead of only looking at the highest bit.
+ *
+ * Apart from the `Priority` overloads of `push()` / `try_push()`, the interface is
+ * the one of the mutex backend (both share `LockedQueue`); plain pushes use
+ * `Priority::Normal`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+
+/* Project libraries */
+
+#include "locked_queue.h"
+#include "queue_backends.h"
+
+/*****************************************************************************/
+
+/**
+ * @class ThreadSafeQueue<T, PriorityBackend, Trace>
+ * @brief Thread-safe queue serving elements by priority level, FIFO within a level.
+ *
+ * @tparam T     Type of element stored in the queue (must be move-constructible).
+ * @tparam Trace Tracing policy for diagnostics (see `queue_trace.h`).
+ *
+ * @details
+ * Locking, waiting, capacity and `close()` come from `LockedQueue`; this class only
+ * stores the levels and picks the one to serve next, so `pop()`, `pop_bulk()` and
+ * friends return elements in priority order.
+ */
+template <typename T, typename Trace>
+class ThreadSafeQueue<T, PriorityBackend, Trace>
+    : public LockedQueue<ThreadSafeQueue<T, PriorityBackend, Trace>, T, Trace>
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty queue.
+     *
+     * @param max_capacity Maximum number of elements over all levels (`0` = unbounded).
+     * @param aging        Wait after which an element is served as if it were one level
+     *                     higher; `zero()` (the default) keeps priorities strict.
+     */
+    explicit ThreadSafeQueue(
+        std::size_t                         max_capacity = 0,
+        std::chrono::steady_clock::duration aging = std::chrono::steady_clock::duration::zero());
+
+    /**
+     * @brief Destructor.
+     */
+    ~ThreadSafeQueue() = default;
+
+    /**
+     * @brief Plain pushes (`push`, `try_push`, `push_for`, `push_bulk`) use
+     *        `Priority::Normal`.
+     */
+    using LockedQueue<ThreadSafeQueue, T, Trace>::push;
+    using LockedQueue<ThreadSafeQueue, T, Trace>::try_push;
+
+    /**
+     * @brief Pushes an element at the given priority, blocking while the queue is full.
+     *
+     * @param data     Rvalue reference to the element being pushed.
+     * @param priority Level the element is queued at.
+     * @return `true` if the element was enqueued, or `false` if the queue was closed.
+     */
+    bool push(T&& data, Priority priority);
+
+    /**
+     * @brief Attempts to push an element at the given priority without blocking.
+     *
+     * @return `true` if the element was enqueued, or `false` if the queue is full or closed.
+     *
+     * @details
+     * `data` is only moved from when the call succeeds.
+     */
+    bool try_push(T&& data, Priority priority);
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Shared locking core; befriended so it can reach the storage hooks.
+     */
+    using Base = LockedQueue<ThreadSafeQueue, T, Trace>;
+    friend Base;
+
+    /**
+     * @brief Stored element with its enqueue time (only stamped when aging is on).
+     */
+    struct Entry
+    {
+        T                                     value;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Appends `data` at `Priority::Normal` (hook used by the plain pushes).
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    void enqueue_locked(T&& data);
+
+    /**
+     * @brief Appends `data` to the FIFO of `priority` and marks the level non-empty.
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    void enqueue_locked(T&& data, Priority priority);
+
+    /**
+     * @brief Returns the level to serve next.
+     *
+     * @note
+     * Must be called with `mtx` held and at least one element stored.
+     */
+    std::size_t next_level() const;
+
+    /**
+     * @brief Removes and returns the front element of `next_level()`.
+     *
+     * @note
+     * Must be called with `mtx` held and at least one element stored.
+     */
+    T dequeue_locked();
+
+    /**
+     * @brief Returns the number of stored elements over all levels.
+     */
+    std::size_t count_locked() const;
+
+    /**
+     * @brief Destroys every stored element and clears the bitmap.
+     */
+    void clear_locked();
+
+    /**
+     * @brief Returns the index of the highest set bit of a non-zero `mask`.
+     */
+    static std::size_t highest_level(unsigned mask);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief One FIFO per priority level, indexed by `static_cast<std::size_t>(Priority)`.
+     */
+    std::deque<Entry> levels[PRIORITY_LEVELS];
+
+    /**
+     * @brief Bit `i` is set while `levels[i]` is non-empty.
+     */
+    unsigned non_empty = 0;
+
+    /**
+     * @brief Number of stored elements over all levels.
+     */
+    std::size_t count = 0;
+
+    /**
+     * @brief Wait that promotes an element by one level (`zero()` = no aging).
+     */
+    const std::chrono::steady_clock::duration aging;
+
+    /******************************************************************/
+};
+
+#include "priority_level_queue.ipp"
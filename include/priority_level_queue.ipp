@@ -0,0 +1,158 @@
+/**
+ * @file        priority_level_queue.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-09>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the multi-level priority backend.
+ *
+ * @details
+ * Synchronization is the shared `LockedQueue` core; this file only implements the
+ * level storage. Without aging, picking the next level is a single
+ * count-leading-zeros on the bitmap.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <utility>
+
+/* Project libraries */
+
+#include "priority_level_queue.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Constructs an empty queue.
+ *
+ * @param max_capacity Maximum number of elements, or `0` for an unbounded queue.
+ * @param aging        Wait that promotes an element by one level, or `zero()`.
+ */
+template <typename T, typename Trace>
+ThreadSafeQueue<T, PriorityBackend, Trace>::ThreadSafeQueue(
+    std::size_t max_capacity, std::chrono::steady_clock::duration aging)
+    : Base(max_capacity), aging(aging) {}
+
+/**
+ * @brief Pushes an element at the given priority.
+ *
+ * @details
+ * GIVEN a producer with latency-critical work,
+ * WHEN `push(data, Priority::High)` is called,
+ * THEN the element is appended to the `High` FIFO and will be popped before every
+ * `Normal` and `Low` element, whenever those were queued.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, PriorityBackend, Trace>::push(T&& data, Priority priority) {
+    return this->push_with([this, &data, priority] { enqueue_locked(std::move(data), priority); });
+}
+
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, PriorityBackend, Trace>::try_push(T&& data, Priority priority) {
+    return this->try_push_with(
+        [this, &data, priority] { enqueue_locked(std::move(data), priority); });
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, PriorityBackend, Trace>::enqueue_locked(T&& data) {
+    enqueue_locked(std::move(data), Priority::Normal);
+}
+
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, PriorityBackend, Trace>::enqueue_locked(T&& data, Priority priority) {
+    const auto level = static_cast<std::size_t>(priority);
+    const auto stamp = aging == std::chrono::steady_clock::duration::zero()
+                           ? std::chrono::steady_clock::time_point()
+                           : std::chrono::steady_clock::now();
+
+    levels[level].push_back(Entry{std::move(data), stamp});
+    non_empty |= 1u << level;
+    ++count;
+}
+
+/**
+ * @brief Picks the level whose front element is the most urgent.
+ *
+ * @details
+ * GIVEN aging is disabled,
+ * WHEN the next level is needed,
+ * THEN it is the highest bit of `non_empty`.
+ *
+ * GIVEN an `aging` interval,
+ * WHEN a `Low` front has waited `3 * aging` while a `High` element is queued,
+ * THEN the `Low` front counts as level `0 + 3`, outranks `High` (2) and is served.
+ * Every non-empty level, `top` included, is scored the same way (`level + waited /
+ * aging`), so a `High` front that has waited as long as the `Low` one still wins.
+ * Ties go to the higher base level. Only fronts are compared, since they are the
+ * oldest elements of their level.
+ */
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, PriorityBackend, Trace>::next_level() const {
+    const std::size_t top = highest_level(non_empty);
+    if (aging == std::chrono::steady_clock::duration::zero() || non_empty == (1u << top))
+        return top;
+
+    const auto now   = std::chrono::steady_clock::now();
+    const auto score = [this, now](std::size_t level) {
+        const auto waited = now - levels[level].front().enqueued;
+        return level + static_cast<std::size_t>(waited / aging);
+    };
+
+    std::size_t best       = top;
+    std::size_t best_score = score(top);
+    for (std::size_t level = top; level-- > 0;) {
+        if ((non_empty & (1u << level)) == 0) continue;
+
+        const std::size_t aged = score(level);
+        if (aged > best_score) {
+            best       = level;
+            best_score = aged;
+        }
+    }
+    return best;
+}
+
+template <typename T, typename Trace>
+T ThreadSafeQueue<T, PriorityBackend, Trace>::dequeue_locked() {
+    const std::size_t  level = next_level();
+    std::deque<Entry>& fifo  = levels[level];
+
+    T data = std::move(fifo.front().value);
+    fifo.pop_front();
+    if (fifo.empty()) non_empty &= ~(1u << level);
+    --count;
+    return data;
+}
+
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, PriorityBackend, Trace>::count_locked() const {
+    return count;
+}
+
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, PriorityBackend, Trace>::clear_locked() {
+    for (auto& level : levels) level.clear();
+    non_empty = 0;
+    count     = 0;
+}
+
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, PriorityBackend, Trace>::highest_level(unsigned mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(31 - __builtin_clz(mask));
+#else
+    std::size_t level = 0;
+    while (mask >>= 1) ++level;
+    return level;
+#endif
+}
+
+/*****************************************************************************/
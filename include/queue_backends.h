@@ -0,0 +1,150 @@
+/**
+ * @file        queue_backends.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-20>
+ * @version     1.0.0
+ *
+ * @brief       Backend selector tags for the ThreadSafeQueue template.
+ *
+ * @details
+ * `ThreadSafeQueue<T, Backend>` is declared here and specialized once per backend.
+ * Every backend exposes the same public interface (`push`, `try_push`, `push_for`,
+ * `push_bulk`, `pop`, `try_pop`, `pop_for`, `pop_until`, `pop_bulk`, `try_pop_bulk`,
+ * `empty`, `size`, `capacity`, `clear`, `close`), so switching the storage strategy
+ * only requires changing the second template argument.
+ *
+ * Available backends:
+ * - `MutexBackend`    → `std::deque` + `std::mutex` (default, optionally bounded).
+ * - `MpmcRingBackend` → lock-free bounded ring buffer (Vyukov MPMC algorithm).
+ * - `SpscRingBackend` → wait-free bounded ring for exactly one producer and one consumer.
+ * - `PriorityBackend` → one `std::deque` per `Priority` level plus a bitmap of non-empty
+ *   levels; adds `push(data, priority)` / `try_push(data, priority)` and optional aging.
+ * - `DeadlineBackend` → binary heap keyed by each element's `deadline()`; serves the
+ *   earliest deadline first (EDF), FIFO among equal deadlines.
+ *
+ * The third template parameter selects the tracing policy used for diagnostics
+ * (`NoQueueTrace` by default, see `queue_trace.h`).
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <condition_variable>
+#include <cstddef>
+
+/* Project libraries */
+
+#include "queue_trace.h"
+
+/*****************************************************************************/
+
+/**
+ * @brief Size assumed for a cache line when padding hot atomic counters.
+ */
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @struct MutexBackend
+ * @brief Selects the mutex-protected `std::deque` implementation (default).
+ */
+struct MutexBackend
+{
+};
+
+/**
+ * @struct MpmcRingBackend
+ * @brief Selects the lock-free, fixed-capacity multi-producer/multi-consumer ring.
+ */
+struct MpmcRingBackend
+{
+};
+
+/**
+ * @struct SpscRingBackend
+ * @brief Selects the wait-free single-producer/single-consumer ring.
+ */
+struct SpscRingBackend
+{
+};
+
+/**
+ * @struct PriorityBackend
+ * @brief Selects the mutex-protected multi-level priority queue.
+ */
+struct PriorityBackend
+{
+};
+
+/**
+ * @struct DeadlineBackend
+ * @brief Selects the mutex-protected earliest-deadline-first heap.
+ */
+struct DeadlineBackend
+{
+};
+
+/**
+ * @enum Priority
+ * @brief Scheduling priority levels understood by `PriorityBackend`.
+ *
+ * @details
+ * Higher values are served first. Other backends accept and ignore the level.
+ */
+enum class Priority
+{
+    Low,      /**< Bulk / background work. */
+    Normal,   /**< Default level. */
+    High,     /**< Latency-sensitive work. */
+    Critical  /**< Served before anything else. */
+};
+
+/**
+ * @brief Number of `Priority` levels.
+ */
+constexpr std::size_t PRIORITY_LEVELS = 4;
+
+/**
+ * @enum PopStatus
+ * @brief Outcome of a timed pop (`pop_for()` / `pop_until()`).
+ */
+enum class PopStatus
+{
+    Item,     /**< An element was popped. */
+    Timeout,  /**< The deadline passed while the queue was empty. */
+    Closed    /**< The queue is closed and fully drained. */
+};
+
+/**
+ * @brief Wakes as many waiters as there are new elements (or freed slots).
+ *
+ * @param cond    Condition variable to signal.
+ * @param n       Number of elements (or slots) made available.
+ * @param waiting Number of threads currently blocked on `cond`.
+ *
+ * @details
+ * A single `notify_all()` is cheaper than a burst of `notify_one()` calls when every
+ * waiter will find work anyway. Shared by every backend that publishes in bulk.
+ */
+inline void notify_n(std::condition_variable& cond, std::size_t n, std::size_t waiting) {
+    if (n >= waiting) {
+        cond.notify_all();
+        return;
+    }
+    for (std::size_t i = 0; i < n; ++i) cond.notify_one();
+}
+
+/**
+ * @brief Thread-safe FIFO queue, specialized per storage backend.
+ *
+ * @tparam T       Type of element stored in the queue.
+ * @tparam Backend Backend tag selecting the implementation (`MutexBackend` by default).
+ * @tparam Trace   Tracing policy for diagnostics (`NoQueueTrace` by default).
+ */
+template <typename T, typename Backend = MutexBackend, typename Trace = NoQueueTrace>
+class ThreadSafeQueue;
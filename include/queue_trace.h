@@ -0,0 +1,65 @@
+/**
+ * @file        queue_trace.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-27>
+ * @version     1.0.0
+ *
+ * @brief       Compile-time tracing policies for ThreadSafeQueue diagnostics.
+ *
+ * @details
+ * Every diagnostic message emitted by a `ThreadSafeQueue` backend goes through the
+ * `Trace` template parameter instead of calling `Logger` directly:
+ *
+ * ```cpp
+ * Trace::trace("[Thread Safe Queue] Task extracted successfully");
+ * ```
+ *
+ * - `NoQueueTrace` (default) has an empty inline body, so the call and its string
+ *   literal vanish at compile time. No `std::string` is built, `Logger::mtx` is never
+ *   taken and `pop()` is no longer serialized behind console I/O.
+ * - `VerboseQueueTrace` forwards each message to `Logger::info()`, restoring the
+ *   historical output for debugging sessions.
+ *
+ * A custom policy only needs a `static void trace(const char*)` member.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/**
+ * @struct NoQueueTrace
+ * @brief Tracing policy that discards every queue diagnostic (production default).
+ */
+struct NoQueueTrace
+{
+    /**
+     * @brief No-op; optimized away entirely.
+     */
+    static void trace(const char*) {}
+};
+
+/**
+ * @struct VerboseQueueTrace
+ * @brief Tracing policy that logs every queue diagnostic at `INFO` level.
+ *
+ * @warning
+ * Messages are emitted from the queue hot paths (sometimes while the queue lock is
+ * held); use it for debugging only.
+ */
+struct VerboseQueueTrace
+{
+    /**
+     * @brief Forwards `msg` to `Logger::info()`.
+     */
+    static void trace(const char* msg) { Logger::info(msg); }
+};
@@ -0,0 +1,360 @@
+/**
+ * @file        spsc_ring_queue.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-22>
+ * @version     1.0.0
+ *
+ * @brief       Wait-free single-producer/single-consumer ring backend for ThreadSafeQueue.
+ *
+ * @details
+ * `ThreadSafeQueue<T, SpscRingBackend>` targets pipelines with exactly **one** producer
+ * thread and **one** consumer thread. Under that contract no CAS is needed:
+ *  - The producer owns `tail` and the consumer owns `head`; each index is published
+ *    with a release store and read by the other side with an acquire load.
+ *  - Each side keeps a private cached copy of the other side's index
+ *    (`cached_head` / `cached_tail`) and only reloads the shared atomic when the cache
+ *    says the ring is full (or empty), so the common case touches no shared cache line.
+ *
+ * The blocking `push()` / `pop()` calls park on a condition variable only as a
+ * slow-path fallback. A waiter flag plus an asymmetric fence pair (see
+ * `asymmetric_fence.h`) make a lost wake-up impossible, so parked threads sleep until
+ * they are notified, while the push/pop fast path stays free of fence instructions.
+ *
+ * @warning
+ * Calling push-side methods from more than one thread, or pop-side methods
+ * (`pop`, `try_pop`, `pop_for`, `pop_until`, `pop_bulk`, `try_pop_bulk`, `clear`) from
+ * more than one thread, is undefined behavior. `WorkerPool` therefore refuses this
+ * backend at compile time: its workers, timer thread and submitters are several
+ * threads on each side.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "asymmetric_fence.h"
+#include "queue_backends.h"
+
+/*****************************************************************************/
+
+/**
+ * @class ThreadSafeQueue<T, SpscRingBackend, Trace>
+ * @brief Wait-free, fixed-capacity FIFO queue for one producer and one consumer.
+ *
+ * @tparam T     Type of element stored in the queue (must be move-constructible).
+ * @tparam Trace Tracing policy for diagnostics (see `queue_trace.h`).
+ */
+template <typename T, typename Trace>
+class ThreadSafeQueue<T, SpscRingBackend, Trace>
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Capacity used when none is given to the constructor.
+     */
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty ring with room for at least `min_capacity` elements.
+     *
+     * @param min_capacity Requested capacity; rounded up to the next power of two
+     *                     (minimum 2).
+     */
+    explicit ThreadSafeQueue(std::size_t min_capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Destructor. Destroys any element still stored in the ring.
+     */
+    ~ThreadSafeQueue();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    ThreadSafeQueue(const ThreadSafeQueue&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    ThreadSafeQueue& operator=(const ThreadSafeQueue&) = delete;
+
+    /**
+     * @brief Disable move constructor.
+     */
+    ThreadSafeQueue(ThreadSafeQueue&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    ThreadSafeQueue& operator=(ThreadSafeQueue&&) = delete;
+
+    /**
+     * @brief Pushes an element, blocking while the ring is full (producer only).
+     *
+     * @param data Rvalue reference to the element being pushed.
+     * @return `true` if the element was enqueued, or `false` if the queue was closed.
+     */
+    bool push(T&& data);
+
+    /**
+     * @brief Attempts to push an element without blocking (producer only).
+     *
+     * @param data Rvalue reference to the element being pushed.
+     * @return `true` on success, `false` if the ring is full or closed.
+     */
+    bool try_push(T&& data);
+
+    /**
+     * @brief Pushes an element, waiting at most `timeout` for a free slot (producer only).
+     *
+     * @param data    Rvalue reference to the element being pushed.
+     * @param timeout Maximum time to wait while the ring is full.
+     * @return `true` on success, `false` on timeout or if the queue was closed.
+     */
+    template <typename Rep, typename Period>
+    bool push_for(T&& data, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Pushes a range of elements, waking the consumer once (producer only).
+     *
+     * @param first Beginning of the range (elements are moved from).
+     * @param last  End of the range.
+     * @return Number of elements enqueued.
+     */
+    template <typename InputIt>
+    std::size_t push_bulk(InputIt first, InputIt last);
+
+    /**
+     * @brief Pops an element, blocking until one is available (consumer only).
+     *
+     * @param[out] data Reference where the popped value will be stored.
+     * @return `true` if an element was retrieved, `false` if the queue is closed and empty.
+     */
+    bool pop(T& data);
+
+    /**
+     * @brief Attempts to pop an element without blocking (consumer only).
+     *
+     * @return The front element, or `nonstd::nullopt` if the ring is empty or closed.
+     */
+    nonstd::optional<T> try_pop();
+
+    /**
+     * @brief Pops an element, waiting at most `timeout` for one to arrive (consumer only).
+     *
+     * @return `PopStatus::Item`, `PopStatus::Timeout` or `PopStatus::Closed` (closed and
+     *         drained).
+     */
+    template <typename Rep, typename Period>
+    PopStatus pop_for(T& data, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Pops an element, waiting until `deadline` for one to arrive (consumer only).
+     *
+     * @return Same as `pop_for()`.
+     */
+    template <typename Clock, typename Duration>
+    PopStatus pop_until(T& data, const std::chrono::time_point<Clock, Duration>& deadline);
+
+    /**
+     * @brief Pops up to `max_n` elements, blocking for the first one (consumer only).
+     *
+     * @return Number of elements popped, or `0` if the queue is closed and empty.
+     */
+    template <typename OutputIt>
+    std::size_t pop_bulk(OutputIt out, std::size_t max_n);
+
+    /**
+     * @brief Pops up to `max_n` elements without blocking (consumer only).
+     *
+     * @return Number of elements popped (`0` if the ring is empty or closed).
+     */
+    template <typename OutputIt>
+    std::size_t try_pop_bulk(OutputIt out, std::size_t max_n);
+
+    /**
+     * @brief Checks whether the ring is currently empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of stored elements.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the number of slots in the ring.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Drains and destroys all stored elements (consumer only).
+     */
+    void clear();
+
+    /**
+     * @brief Closes the queue and wakes the parked producer and consumer.
+     */
+    void close();
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Raw storage for one element.
+     */
+    using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+   private:
+    /**
+     * @brief Fast-path attempts made before parking on a condition variable.
+     */
+    static constexpr int SPIN_LIMIT = 64;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Rounds `n` up to the next power of two (minimum 2).
+     */
+    static std::size_t round_up_pow2(std::size_t n);
+
+    /**
+     * @brief Wait-free enqueue attempt; moves from `data` only on success.
+     */
+    bool enqueue(T& data);
+
+    /**
+     * @brief Wait-free dequeue attempt.
+     */
+    nonstd::optional<T> dequeue();
+
+    /**
+     * @brief Dequeues up to `max_n` elements into `out`; returns how many were written.
+     */
+    template <typename OutputIt>
+    std::size_t drain(OutputIt& out, std::size_t max_n);
+
+    /**
+     * @brief Returns `true` if the ring holds at least one element.
+     */
+    bool readable() const;
+
+    /**
+     * @brief Returns `true` if the ring has at least one free slot.
+     */
+    bool writable() const;
+
+    /**
+     * @brief Wakes the consumer if it is parked.
+     */
+    void wake_consumer();
+
+    /**
+     * @brief Wakes the producer if it is parked.
+     */
+    void wake_producer();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Index mask (`capacity - 1`).
+     */
+    const std::size_t mask;
+
+    /**
+     * @brief Element storage.
+     */
+    std::unique_ptr<Slot[]> slots;
+
+    /**
+     * @brief Next slot to read, written only by the consumer.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head;
+
+    /**
+     * @brief Consumer's cached copy of `tail`.
+     */
+    std::size_t cached_tail;
+
+    /**
+     * @brief Next slot to write, written only by the producer.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail;
+
+    /**
+     * @brief Producer's cached copy of `head`.
+     */
+    std::size_t cached_head;
+
+    /**
+     * @brief Graceful shutdown flag.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> closed;
+
+    /**
+     * @brief `1` while the consumer is parked on `data_cv`.
+     */
+    std::atomic<int> waiting_consumers;
+
+    /**
+     * @brief `1` while the producer is parked on `space_cv`.
+     */
+    std::atomic<int> waiting_producers;
+
+    /**
+     * @brief Mutex used only by the blocking slow path.
+     */
+    std::mutex wait_mtx;
+
+    /**
+     * @brief Signals the parked consumer that data was published.
+     */
+    std::condition_variable data_cv;
+
+    /**
+     * @brief Signals the parked producer that a slot was released.
+     */
+    std::condition_variable space_cv;
+
+    /******************************************************************/
+};
+
+#include "spsc_ring_queue.ipp"
@@ -0,0 +1,494 @@
+/**
+ * @file        spsc_ring_queue.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-22>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the single-producer/single-consumer ring backend.
+ *
+ * @details
+ * Indices grow monotonically and are mapped to slots with `mask`; the ring is
+ * full when `tail - head == capacity` and empty when `tail == head`.
+ *
+ * Parking: a thread about to sleep raises its waiter flag and issues
+ * `asymmetric_heavy_fence()` before re-checking the ring under `wait_mtx`; a
+ * publisher issues `asymmetric_light_fence()` between publishing its index and
+ * reading the flag. Either the waiter sees the new element (or slot), or the
+ * publisher sees the flag and notifies under the mutex, so no wake-up is lost and
+ * parked threads need no timed re-checks. The barrier is paid by the side that is
+ * about to sleep; on Linux a push or pop costs no fence instruction.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <new>
+#include <utility>
+
+/* Project libraries */
+
+#include "spsc_ring_queue.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Allocates the ring storage.
+ *
+ * @param min_capacity Requested capacity, rounded up to a power of two.
+ */
+template <typename T, typename Trace>
+ThreadSafeQueue<T, SpscRingBackend, Trace>::ThreadSafeQueue(std::size_t min_capacity)
+    : mask(round_up_pow2(min_capacity) - 1),
+      slots(new Slot[mask + 1]),
+      head(0),
+      cached_tail(0),
+      tail(0),
+      cached_head(0),
+      closed(false),
+      waiting_consumers(0),
+      waiting_producers(0) {}
+
+/**
+ * @brief Destroys any element left in the ring.
+ */
+template <typename T, typename Trace>
+ThreadSafeQueue<T, SpscRingBackend, Trace>::~ThreadSafeQueue() {
+    while (dequeue()) {
+    }
+}
+
+/**
+ * @brief Pushes an element, parking the producer while the ring is full.
+ *
+ * @param data Rvalue reference to the element to be enqueued.
+ * @return `true` if the element was enqueued, `false` if the queue was closed.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::push(T&& data) {
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            if (closed.load(std::memory_order_acquire)) return false;
+            if (enqueue(data)) {
+                wake_consumer();
+                return true;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_producers.store(1, std::memory_order_relaxed);
+        asymmetric_heavy_fence();
+        space_cv.wait(lock,
+                      [this] { return closed.load(std::memory_order_acquire) || writable(); });
+        waiting_producers.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Attempts a single wait-free enqueue.
+ *
+ * @param data Rvalue reference to the element to be enqueued.
+ * @return `true` on success, `false` if the ring is full or closed.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::try_push(T&& data) {
+    if (closed.load(std::memory_order_acquire) || !enqueue(data)) return false;
+
+    wake_consumer();
+    return true;
+}
+
+/**
+ * @brief Pushes an element, waiting at most `timeout` for a free slot.
+ *
+ * @param data    Rvalue reference to the element to be enqueued.
+ * @param timeout Maximum time to wait while the ring is full.
+ * @return `true` on success, `false` on timeout or closure.
+ */
+template <typename T, typename Trace>
+template <typename Rep, typename Period>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::push_for(
+    T&& data, const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            if (closed.load(std::memory_order_acquire)) return false;
+            if (enqueue(data)) {
+                wake_consumer();
+                return true;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_producers.store(1, std::memory_order_relaxed);
+        asymmetric_heavy_fence();
+        const bool ready = space_cv.wait_until(lock, deadline, [this] {
+            return closed.load(std::memory_order_acquire) || writable();
+        });
+        waiting_producers.store(0, std::memory_order_relaxed);
+
+        if (!ready) return false;
+    }
+}
+
+/**
+ * @brief Pushes a range of elements, waking the consumer once per batch.
+ *
+ * @param first Beginning of the range (elements are moved from).
+ * @param last  End of the range.
+ * @return Number of elements enqueued (less than the range size only if the queue
+ *         was closed).
+ */
+template <typename T, typename Trace>
+template <typename InputIt>
+std::size_t ThreadSafeQueue<T, SpscRingBackend, Trace>::push_bulk(InputIt first, InputIt last) {
+    std::size_t pushed = 0;
+    std::size_t batch  = 0;
+
+    for (; first != last; ++first) {
+        if (closed.load(std::memory_order_acquire)) break;
+
+        auto&& item = *first;
+        if (enqueue(item)) {
+            ++batch;
+        } else {
+            if (batch != 0) wake_consumer();
+            batch = 0;
+            if (!push(std::move(item))) break;
+        }
+        ++pushed;
+    }
+
+    if (batch != 0) wake_consumer();
+    return pushed;
+}
+
+/**
+ * @brief Pops an element, parking the consumer while the ring is empty.
+ *
+ * @param[out] data Reference where the extracted element will be stored.
+ * @return `true` if an element was retrieved, `false` if the queue is closed and drained.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::pop(T& data) {
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            const bool was_closed = closed.load(std::memory_order_acquire);
+
+            nonstd::optional<T> item = dequeue();
+            if (item) {
+                data = std::move(*item);
+                wake_producer();
+                return true;
+            }
+
+            if (was_closed) return false;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_consumers.store(1, std::memory_order_relaxed);
+        asymmetric_heavy_fence();
+        data_cv.wait(lock, [this] { return closed.load(std::memory_order_acquire) || readable(); });
+        waiting_consumers.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Attempts a single wait-free dequeue.
+ *
+ * @return The front element, or `nonstd::nullopt` if the ring is empty or closed.
+ */
+template <typename T, typename Trace>
+nonstd::optional<T> ThreadSafeQueue<T, SpscRingBackend, Trace>::try_pop() {
+    if (closed.load(std::memory_order_acquire)) return nonstd::nullopt;
+
+    nonstd::optional<T> item = dequeue();
+    if (item) wake_producer();
+    return item;
+}
+
+/**
+ * @brief Pops an element, waiting at most `timeout` for one to arrive.
+ */
+template <typename T, typename Trace>
+template <typename Rep, typename Period>
+PopStatus ThreadSafeQueue<T, SpscRingBackend, Trace>::pop_for(
+    T& data, const std::chrono::duration<Rep, Period>& timeout) {
+    using clock = std::chrono::steady_clock;
+    return pop_until(data, clock::now() + std::chrono::duration_cast<clock::duration>(timeout));
+}
+
+/**
+ * @brief Pops an element, parking the consumer at most until `deadline`.
+ *
+ * @param[out] data     Reference where the extracted element will be stored.
+ * @param      deadline Point in time after which the call gives up.
+ * @return `PopStatus::Item`, `PopStatus::Timeout` or `PopStatus::Closed`.
+ *
+ * @details
+ * Parks like `pop()`, but gives up at `deadline`.
+ */
+template <typename T, typename Trace>
+template <typename Clock, typename Duration>
+PopStatus ThreadSafeQueue<T, SpscRingBackend, Trace>::pop_until(
+    T& data, const std::chrono::time_point<Clock, Duration>& deadline) {
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            const bool was_closed = closed.load(std::memory_order_acquire);
+
+            nonstd::optional<T> item = dequeue();
+            if (item) {
+                data = std::move(*item);
+                wake_producer();
+                return PopStatus::Item;
+            }
+
+            if (was_closed) return PopStatus::Closed;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_consumers.store(1, std::memory_order_relaxed);
+        asymmetric_heavy_fence();
+        const bool ready = data_cv.wait_until(lock, deadline, [this] {
+            return closed.load(std::memory_order_acquire) || readable();
+        });
+        waiting_consumers.store(0, std::memory_order_relaxed);
+
+        if (!ready) return PopStatus::Timeout;
+    }
+}
+
+/**
+ * @brief Pops up to `max_n` elements, parking until at least one is available.
+ *
+ * @param out   Output iterator receiving the elements in FIFO order.
+ * @param max_n Maximum number of elements to extract.
+ * @return Number of elements extracted, or `0` if the queue is closed and drained.
+ */
+template <typename T, typename Trace>
+template <typename OutputIt>
+std::size_t ThreadSafeQueue<T, SpscRingBackend, Trace>::pop_bulk(OutputIt out, std::size_t max_n) {
+    if (max_n == 0) return 0;
+
+    for (;;) {
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            const bool was_closed = closed.load(std::memory_order_acquire);
+
+            const std::size_t n = drain(out, max_n);
+            if (n != 0) {
+                wake_producer();
+                return n;
+            }
+
+            if (was_closed) return 0;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mtx);
+        waiting_consumers.store(1, std::memory_order_relaxed);
+        asymmetric_heavy_fence();
+        data_cv.wait(lock, [this] { return closed.load(std::memory_order_acquire) || readable(); });
+        waiting_consumers.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Pops up to `max_n` elements without blocking.
+ *
+ * @param out   Output iterator receiving the elements in FIFO order.
+ * @param max_n Maximum number of elements to extract.
+ * @return Number of elements extracted (`0` if the ring is empty or closed).
+ */
+template <typename T, typename Trace>
+template <typename OutputIt>
+std::size_t ThreadSafeQueue<T, SpscRingBackend, Trace>::try_pop_bulk(OutputIt    out,
+                                                                  std::size_t max_n) {
+    if (closed.load(std::memory_order_acquire)) return 0;
+
+    const std::size_t n = drain(out, max_n);
+    if (n != 0) wake_producer();
+    return n;
+}
+
+/**
+ * @brief Checks whether the ring is empty.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::empty() const {
+    return size() == 0;
+}
+
+/**
+ * @brief Returns the number of stored elements.
+ *
+ * @note
+ * `head` is read first so the result never underflows.
+ */
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, SpscRingBackend, Trace>::size() const {
+    const std::size_t h = head.load(std::memory_order_acquire);
+    const std::size_t t = tail.load(std::memory_order_acquire);
+    return t - h;
+}
+
+/**
+ * @brief Returns the power-of-two capacity of the ring.
+ */
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, SpscRingBackend, Trace>::capacity() const {
+    return mask + 1;
+}
+
+/**
+ * @brief Drains and destroys all stored elements.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, SpscRingBackend, Trace>::clear() {
+    while (dequeue()) {
+    }
+    Trace::trace("[Thread Safe Queue] Tasks cleaned");
+    wake_producer();
+}
+
+/**
+ * @brief Closes the queue and wakes both sides.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, SpscRingBackend, Trace>::close() {
+    closed.store(true, std::memory_order_release);
+    Trace::trace("[Thread Safe Queue] Task queue closed");
+
+    std::lock_guard<std::mutex> lock(wait_mtx);
+    data_cv.notify_all();
+    space_cv.notify_all();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Rounds `n` up to the next power of two, with a minimum of 2.
+ */
+template <typename T, typename Trace>
+std::size_t ThreadSafeQueue<T, SpscRingBackend, Trace>::round_up_pow2(std::size_t n) {
+    std::size_t capacity = 2;
+    while (capacity < n) capacity <<= 1;
+    return capacity;
+}
+
+/**
+ * @brief Writes `data` into the next free slot.
+ *
+ * @param data Element to move into the ring (left untouched on failure).
+ * @return `true` on success, `false` if the ring is full.
+ *
+ * @details
+ * The consumer's `head` is only reloaded when the cached copy says the ring is full.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::enqueue(T& data) {
+    const std::size_t t = tail.load(std::memory_order_relaxed);
+
+    if (t - cached_head > mask) {
+        cached_head = head.load(std::memory_order_acquire);
+        if (t - cached_head > mask) return false;
+    }
+
+    new (&slots[t & mask]) T(std::move(data));
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Moves the front element out of the ring.
+ *
+ * @return The extracted element, or `nonstd::nullopt` if the ring is empty.
+ *
+ * @details
+ * The producer's `tail` is only reloaded when the cached copy says the ring is empty.
+ */
+template <typename T, typename Trace>
+nonstd::optional<T> ThreadSafeQueue<T, SpscRingBackend, Trace>::dequeue() {
+    const std::size_t h = head.load(std::memory_order_relaxed);
+
+    if (h == cached_tail) {
+        cached_tail = tail.load(std::memory_order_acquire);
+        if (h == cached_tail) return nonstd::nullopt;
+    }
+
+    T*                  slot = reinterpret_cast<T*>(&slots[h & mask]);
+    nonstd::optional<T> item(std::move(*slot));
+    slot->~T();
+    head.store(h + 1, std::memory_order_release);
+    return item;
+}
+
+/**
+ * @brief Dequeues up to `max_n` elements into `out`.
+ *
+ * @return Number of elements written.
+ */
+template <typename T, typename Trace>
+template <typename OutputIt>
+std::size_t ThreadSafeQueue<T, SpscRingBackend, Trace>::drain(OutputIt& out, std::size_t max_n) {
+    std::size_t n = 0;
+    for (; n < max_n; ++n) {
+        nonstd::optional<T> item = dequeue();
+        if (!item) break;
+        *out++ = std::move(*item);
+    }
+    return n;
+}
+
+/**
+ * @brief Returns `true` if the consumer has at least one element to read.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::readable() const {
+    return tail.load(std::memory_order_acquire) != head.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns `true` if the producer has at least one free slot.
+ */
+template <typename T, typename Trace>
+bool ThreadSafeQueue<T, SpscRingBackend, Trace>::writable() const {
+    return tail.load(std::memory_order_relaxed) - head.load(std::memory_order_acquire) <= mask;
+}
+
+/**
+ * @brief Notifies the consumer, taking the mutex only if it is parked.
+ *
+ * @details
+ * The light fence pairs with the heavy one issued by the consumer after raising
+ * `waiting_consumers`: either the consumer sees the published `tail` in its
+ * predicate, or this thread sees the flag and notifies.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, SpscRingBackend, Trace>::wake_consumer() {
+    asymmetric_light_fence();
+    if (waiting_consumers.load(std::memory_order_relaxed) == 0) return;
+
+    std::lock_guard<std::mutex> lock(wait_mtx);
+    data_cv.notify_one();
+}
+
+/**
+ * @brief Notifies the producer, taking the mutex only if it is parked.
+ *
+ * @details
+ * Same fence pairing as `wake_consumer()`, with `head` and `waiting_producers`.
+ */
+template <typename T, typename Trace>
+void ThreadSafeQueue<T, SpscRingBackend, Trace>::wake_producer() {
+    asymmetric_light_fence();
+    if (waiting_producers.load(std::memory_order_relaxed) == 0) return;
+
+    std::lock_guard<std::mutex> lock(wait_mtx);
+    space_cv.notify_one();
+}
+
+/*****************************************************************************/
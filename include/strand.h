@@ -0,0 +1,179 @@
+/**
+ * @file        strand.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-11>
+ * @version     1.0.0
+ *
+ * @brief       Serial executor running its tasks in order on a shared WorkerPool.
+ *
+ * @details
+ * A `Strand` keeps its own FIFO of tasks and at most one **drain task** in the pool:
+ *  - the first task submitted to an idle strand schedules a drain task;
+ *  - the drain task runs the strand's tasks one after another, then returns the
+ *    worker as soon as the strand is empty (or after `BATCH_LIMIT` tasks, rescheduling
+ *    itself so other work gets a turn);
+ *  - tasks submitted while a drain is active are picked up by that same drain.
+ *
+ * Tasks of one strand therefore run in submission order and never overlap, while an
+ * empty strand costs no thread at all: thousands of strands can share a few workers.
+ * Tasks whose cancellation token is cancelled, or whose deadline has passed when
+ * their turn comes, are skipped exactly as the pool's workers would skip them.
+ *
+ * Example:
+ * ```cpp
+ * Strand session(pool);
+ * session.submit([] { parse_header(); });
+ * session.submit([] { parse_body(); });   // starts after parse_header() returned
+ * ```
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+/* Project libraries */
+
+#include "task.h"
+#include "task_future.h"
+#include "worker_pool.h"
+
+/*****************************************************************************/
+
+/**
+ * @class Strand
+ * @brief FIFO, non-overlapping execution of tasks on a shared WorkerPool.
+ *
+ * @details
+ * The pool must outlive the strand's tasks. Destroying a `Strand` does not cancel
+ * tasks already submitted to it; they still run, in order.
+ */
+class Strand
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Tasks run by one drain task before it yields the worker.
+     */
+    static constexpr std::size_t BATCH_LIMIT = 32;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Creates an empty strand on `pool`.
+     */
+    explicit Strand(WorkerPool& pool);
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    Strand(const Strand&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    Strand& operator=(const Strand&) = delete;
+
+    /**
+     * @brief Appends `task` to the strand.
+     *
+     * @details
+     * GIVEN a strand with tasks A and B already submitted,
+     * WHEN C is submitted from any thread,
+     * THEN C starts only after B has returned, and on whichever worker is free then.
+     *
+     * @note
+     * - Thread-safe. Exceptions thrown by a task are logged and do not stop the strand.
+     * - If the pool rejects the drain task (it is stopping), every pending task of the
+     *   strand is dropped with a warning and the strand is left idle.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Appends `f(args...)` to the strand and returns a future for its result.
+     */
+    template <typename F, typename... Args,
+              typename = typename std::enable_if<
+                  !std::is_same<typename std::decay<F>::type, Task>::value>::type>
+    TaskFuture<TaskResultOf<F, Args...>> submit(F&& f, Args&&... args);
+
+    /**
+     * @brief Returns `true` if the calling thread is running one of this strand's tasks.
+     */
+    bool running_in_this_thread() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief State shared by the strand and its drain task.
+     */
+    struct State
+    {
+        explicit State(WorkerPool& pool) : pool(pool) {}
+
+        WorkerPool&      pool;              /**< Pool running the drain task. */
+        std::mutex       mtx;               /**< Protects `tasks` and `scheduled`. */
+        std::deque<Task> tasks;             /**< Pending tasks, in submission order. */
+        bool             scheduled = false; /**< A drain task is queued or running. */
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Runs up to `BATCH_LIMIT` pending tasks of `state`.
+     */
+    static void drain(const std::shared_ptr<State>& state);
+
+    /**
+     * @brief Submits a drain task for `state` to its pool.
+     *
+     * @return `false` if the pool rejected it.
+     */
+    static bool schedule(const std::shared_ptr<State>& state);
+
+    /**
+     * @brief Clears `scheduled` and drops every pending task (the pool refused to drain).
+     */
+    static void abandon(const std::shared_ptr<State>& state);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Shared with in-flight drain tasks, so it outlives the `Strand` if needed.
+     */
+    std::shared_ptr<State> state;
+
+    /**
+     * @brief State of the strand whose drain task runs on the current thread.
+     */
+    static thread_local const State* current;
+
+    /******************************************************************/
+};
+
+#include "strand.ipp"
@@ -0,0 +1,30 @@
+/**
+ * @file        strand.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-11>
+ * @version     1.0.0
+ *
+ * @brief       Template members of the Strand class.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "strand.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Packages `f(args...)` with its future and appends it to the strand.
+ */
+template <typename F, typename... Args, typename>
+TaskFuture<TaskResultOf<F, Args...>> Strand::submit(F&& f, Args&&... args) {
+    auto packaged = make_future_task(std::forward<F>(f), std::forward<Args>(args)...);
+    submit(std::move(packaged.first));
+    return std::move(packaged.second);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,319 @@
+/**
+ * @file        task.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-29>
+ * @version     1.0.0
+ *
+ * @brief       Move-only callable wrapper with small-buffer optimization.
+ *
+ * @details
+ * `BasicTask<InlineSize>` is the unit of work stored in the WorkerPool queue. Compared
+ * to `std::function<void()>` it:
+ *  - Is **move-only**, so tasks may capture move-only state such as `std::unique_ptr`.
+ *  - Stores callables of up to `InlineSize` bytes **inline**, without touching the heap.
+ *    Only callables that are larger, over-aligned or not nothrow-movable fall back to a
+ *    single heap allocation.
+ *
+ * Type erasure uses one static table of function pointers per callable type
+ * (invoke / relocate / destroy), so a task costs one pointer plus its inline buffer.
+ * Three pieces of metadata travel with the callable and are carried along by moves:
+ *  - a submit timestamp, used by the WorkerPool instrumentation;
+ *  - a `CancellationToken`, checked by the WorkerPool before running the task;
+ *  - an optional deadline, past which the WorkerPool sheds the task instead of running it.
+ * They sit in front of the aligned inline buffer and are not free: on LP64 ABIs with a
+ * 16-byte `max_align_t` they form a 32-byte header, so `sizeof(Task)` is 96 bytes
+ * instead of 80. The token accounts for all 16 extra bytes (8 for its pointer, 8 of
+ * padding before the buffer); the deadline then fills that padding at no extra cost.
+ *
+ * `Task` is the alias used throughout the project (`TASK_INLINE_SIZE` bytes of storage).
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/* Project libraries */
+
+#include "cancellation.h"
+
+/*****************************************************************************/
+
+/**
+ * @brief Default inline storage, in bytes, of the project-wide `Task` alias.
+ */
+constexpr std::size_t TASK_INLINE_SIZE = 64;
+
+/**
+ * @class BasicTask
+ * @brief Move-only `void()` callable with `InlineSize` bytes of inline storage.
+ *
+ * @tparam InlineSize Size of the inline buffer; callables up to this size are stored
+ *                    without heap allocation.
+ */
+template <std::size_t InlineSize>
+class BasicTask
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty task.
+     */
+    BasicTask() noexcept = default;
+
+    /**
+     * @brief Wraps any callable invocable as `void()`.
+     *
+     * @tparam F Callable type (lambda, functor, `std::function`, ...); only takes part
+     *           in overload resolution if it can be called without arguments.
+     * @param f Callable to store; moved or copied into the task.
+     *
+     * @details
+     * Implicit on purpose, so `pool.submit([] { ... })` works unchanged.
+     * A null callable (an empty `std::function`, a null function pointer: anything
+     * that compares equal to `nullptr`) gives an empty task.
+     */
+    template <typename F,
+              typename = typename std::enable_if<
+                  !std::is_same<typename std::decay<F>::type, BasicTask>::value>::type,
+              typename = decltype(std::declval<typename std::decay<F>::type&>()())>
+    BasicTask(F&& f);
+
+    /**
+     * @brief Move constructor; leaves `other` empty.
+     */
+    BasicTask(BasicTask&& other) noexcept;
+
+    /**
+     * @brief Move assignment; destroys the current callable and leaves `other` empty.
+     */
+    BasicTask& operator=(BasicTask&& other) noexcept;
+
+    /**
+     * @brief Deleted copy constructor (tasks are move-only).
+     */
+    BasicTask(const BasicTask&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator (tasks are move-only).
+     */
+    BasicTask& operator=(const BasicTask&) = delete;
+
+    /**
+     * @brief Destroys the stored callable, if any.
+     */
+    ~BasicTask();
+
+    /**
+     * @brief Invokes the stored callable.
+     *
+     * @throws std::bad_function_call if the task is empty.
+     */
+    void operator()();
+
+    /**
+     * @brief Returns `true` if the task holds a callable.
+     */
+    explicit operator bool() const noexcept { return ops != nullptr; }
+
+    /**
+     * @brief Returns `true` if the callable lives in the inline buffer (no heap allocation).
+     */
+    bool is_inline() const noexcept { return ops != nullptr && ops->is_inline; }
+
+    /**
+     * @brief Records when the task was submitted (moves carry it along).
+     */
+    void set_submit_time(std::chrono::steady_clock::time_point when) noexcept { submitted = when; }
+
+    /**
+     * @brief Returns the submit time, or a default-constructed time point if never set.
+     */
+    std::chrono::steady_clock::time_point submit_time() const noexcept { return submitted; }
+
+    /**
+     * @brief Attaches the token the WorkerPool checks before running the task.
+     */
+    void set_cancellation_token(CancellationToken token) noexcept
+    {
+        cancellation = std::move(token);
+    }
+
+    /**
+     * @brief Returns the attached token (a never-cancelled token by default).
+     */
+    const CancellationToken& cancellation_token() const noexcept { return cancellation; }
+
+    /**
+     * @brief Sets the point in time after which the task is no longer worth running.
+     */
+    void set_deadline(std::chrono::steady_clock::time_point when) noexcept { expires = when; }
+
+    /**
+     * @brief Returns the deadline, or `time_point::max()` if none was set.
+     */
+    std::chrono::steady_clock::time_point deadline() const noexcept { return expires; }
+
+    /**
+     * @brief Returns `true` if a deadline was set.
+     */
+    bool has_deadline() const noexcept
+    {
+        return expires != std::chrono::steady_clock::time_point::max();
+    }
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @struct Ops
+     * @brief Per-callable-type operation table.
+     */
+    struct Ops
+    {
+        void (*invoke)(void* storage);          /**< Calls the callable. */
+        void (*relocate)(void* dst, void* src); /**< Moves `src` into `dst`, destroys `src`. */
+        void (*destroy)(void* storage);         /**< Destroys the callable. */
+        bool is_inline;                         /**< Stored inline or on the heap. */
+    };
+
+    /**
+     * @brief Operations for a callable stored directly in the inline buffer.
+     */
+    template <typename F>
+    struct InlineOps
+    {
+        static void invoke(void* storage);
+        static void relocate(void* dst, void* src);
+        static void destroy(void* storage);
+
+        static const Ops table;
+    };
+
+    /**
+     * @brief Operations for a callable stored on the heap (the buffer holds a pointer).
+     */
+    template <typename F>
+    struct HeapOps
+    {
+        static void invoke(void* storage);
+        static void relocate(void* dst, void* src);
+        static void destroy(void* storage);
+
+        static const Ops table;
+    };
+
+    /**
+     * @brief `true` if a callable of type `F` can be stored inline.
+     */
+    template <typename F>
+    using fits_inline =
+        std::integral_constant<bool, sizeof(F) <= InlineSize &&
+                                         alignof(F) <= alignof(std::max_align_t) &&
+                                         std::is_nothrow_move_constructible<F>::value>;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Stores `f` inline.
+     */
+    template <typename F, typename Arg>
+    void emplace(Arg&& f, std::true_type);
+
+    /**
+     * @brief Stores `f` on the heap.
+     */
+    template <typename F, typename Arg>
+    void emplace(Arg&& f, std::false_type);
+
+    /**
+     * @brief Destroys the stored callable and leaves the task empty.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Returns `f == nullptr` for callables that can be null.
+     */
+    template <typename F>
+    static auto is_null(const F& f, int) -> decltype(static_cast<bool>(f == nullptr));
+
+    /**
+     * @brief Fallback for callables that cannot be null (lambdas, functors).
+     */
+    template <typename F>
+    static bool is_null(const F& f, long);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Operation table of the stored callable (`nullptr` when empty).
+     */
+    const Ops* ops = nullptr;
+
+    /**
+     * @brief Submit timestamp (epoch of `steady_clock` when unset).
+     */
+    std::chrono::steady_clock::time_point submitted{};
+
+    /**
+     * @brief Token checked before the task runs.
+     *
+     * @note
+     * Costs 16 bytes on LP64: its pointer plus the padding it opens before `storage`.
+     */
+    CancellationToken cancellation;
+
+    /**
+     * @brief Deadline (`time_point::max()` when the task has none).
+     *
+     * @note
+     * Occupies the alignment padding between `cancellation` and `storage` on LP64.
+     */
+    std::chrono::steady_clock::time_point expires = std::chrono::steady_clock::time_point::max();
+
+    /**
+     * @brief Inline buffer holding either the callable or a pointer to it.
+     */
+    alignas(std::max_align_t) unsigned char storage[InlineSize < sizeof(void*) ? sizeof(void*)
+                                                                               : InlineSize];
+
+    /******************************************************************/
+};
+
+/**
+ * @brief Project-wide task type stored in the WorkerPool queue.
+ */
+using Task = BasicTask<TASK_INLINE_SIZE>;
+
+/**
+ * @brief Pins the metadata cost documented above: a 32-byte header on LP64 ABIs.
+ *
+ * @details
+ * Any new member must either fit in existing padding or update the documented size.
+ */
+static_assert(sizeof(void*) != 8 || alignof(std::max_align_t) != 16 ||
+                  sizeof(Task) == TASK_INLINE_SIZE + 32,
+              "Task metadata no longer fits the documented 32-byte header");
+
+#include "task.ipp"
@@ -0,0 +1,210 @@
+/**
+ * @file        task.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-29>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the BasicTask template class.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <new>
+
+/* Project libraries */
+
+#include "task.h"
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+template <std::size_t InlineSize>
+template <typename F>
+const typename BasicTask<InlineSize>::Ops BasicTask<InlineSize>::InlineOps<F>::table = {
+    &InlineOps<F>::invoke, &InlineOps<F>::relocate, &InlineOps<F>::destroy, true};
+
+template <std::size_t InlineSize>
+template <typename F>
+const typename BasicTask<InlineSize>::Ops BasicTask<InlineSize>::HeapOps<F>::table = {
+    &HeapOps<F>::invoke, &HeapOps<F>::relocate, &HeapOps<F>::destroy, false};
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Wraps a callable, inline when it fits and on the heap otherwise.
+ *
+ * @param f Callable to store.
+ *
+ * @details
+ * GIVEN a lambda capturing a few pointers or a `std::unique_ptr`,
+ * WHEN it is converted to a task,
+ * THEN it is move-constructed into the inline buffer and no allocation happens.
+ *
+ * GIVEN an empty `std::function` or a null function pointer,
+ * WHEN it is converted to a task,
+ * THEN nothing is stored and the task reports empty, like a default-constructed one.
+ */
+template <std::size_t InlineSize>
+template <typename F, typename, typename>
+BasicTask<InlineSize>::BasicTask(F&& f) {
+    using Callable = typename std::decay<F>::type;
+    if (is_null(f, 0)) return;
+    emplace<Callable>(std::forward<F>(f), fits_inline<Callable>{});
+}
+
+/**
+ * @brief Move constructor; relocates the callable out of `other`.
+ */
+template <std::size_t InlineSize>
+BasicTask<InlineSize>::BasicTask(BasicTask&& other) noexcept
+    : ops(other.ops),
+      submitted(other.submitted),
+      cancellation(std::move(other.cancellation)),
+      expires(other.expires) {
+    if (ops != nullptr) {
+        ops->relocate(storage, other.storage);
+        other.ops = nullptr;
+    }
+}
+
+/**
+ * @brief Move assignment; destroys the current callable and relocates `other`'s.
+ */
+template <std::size_t InlineSize>
+BasicTask<InlineSize>& BasicTask<InlineSize>::operator=(BasicTask&& other) noexcept {
+    if (this != &other) {
+        reset();
+        submitted    = other.submitted;
+        cancellation = std::move(other.cancellation);
+        expires      = other.expires;
+        if (other.ops != nullptr) {
+            other.ops->relocate(storage, other.storage);
+            ops       = other.ops;
+            other.ops = nullptr;
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys the stored callable.
+ */
+template <std::size_t InlineSize>
+BasicTask<InlineSize>::~BasicTask() {
+    reset();
+}
+
+/**
+ * @brief Invokes the stored callable.
+ *
+ * @throws std::bad_function_call if the task is empty, matching `std::function`.
+ */
+template <std::size_t InlineSize>
+void BasicTask<InlineSize>::operator()() {
+    if (ops == nullptr) throw std::bad_function_call();
+    ops->invoke(storage);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Constructs the callable directly inside the inline buffer.
+ */
+template <std::size_t InlineSize>
+template <typename F, typename Arg>
+void BasicTask<InlineSize>::emplace(Arg&& f, std::true_type) {
+    new (static_cast<void*>(storage)) F(std::forward<Arg>(f));
+    ops = &InlineOps<F>::table;
+}
+
+/**
+ * @brief Allocates the callable on the heap and keeps its pointer in the buffer.
+ */
+template <std::size_t InlineSize>
+template <typename F, typename Arg>
+void BasicTask<InlineSize>::emplace(Arg&& f, std::false_type) {
+    new (static_cast<void*>(storage)) F*(new F(std::forward<Arg>(f)));
+    ops = &HeapOps<F>::table;
+}
+
+/**
+ * @brief Preferred overload: selected whenever `f == nullptr` is well-formed.
+ */
+template <std::size_t InlineSize>
+template <typename F>
+auto BasicTask<InlineSize>::is_null(const F& f, int)
+    -> decltype(static_cast<bool>(f == nullptr)) {
+    return f == nullptr;
+}
+
+template <std::size_t InlineSize>
+template <typename F>
+bool BasicTask<InlineSize>::is_null(const F&, long) {
+    return false;
+}
+
+/**
+ * @brief Destroys the stored callable and marks the task empty.
+ */
+template <std::size_t InlineSize>
+void BasicTask<InlineSize>::reset() noexcept {
+    if (ops != nullptr) {
+        ops->destroy(storage);
+        ops = nullptr;
+    }
+}
+
+/*****************************************************************************/
+
+/* Inline storage operations */
+
+template <std::size_t InlineSize>
+template <typename F>
+void BasicTask<InlineSize>::InlineOps<F>::invoke(void* storage) {
+    (*static_cast<F*>(storage))();
+}
+
+template <std::size_t InlineSize>
+template <typename F>
+void BasicTask<InlineSize>::InlineOps<F>::relocate(void* dst, void* src) {
+    F* from = static_cast<F*>(src);
+    new (dst) F(std::move(*from));
+    from->~F();
+}
+
+template <std::size_t InlineSize>
+template <typename F>
+void BasicTask<InlineSize>::InlineOps<F>::destroy(void* storage) {
+    static_cast<F*>(storage)->~F();
+}
+
+/*****************************************************************************/
+
+/* Heap storage operations */
+
+template <std::size_t InlineSize>
+template <typename F>
+void BasicTask<InlineSize>::HeapOps<F>::invoke(void* storage) {
+    (**static_cast<F**>(storage))();
+}
+
+template <std::size_t InlineSize>
+template <typename F>
+void BasicTask<InlineSize>::HeapOps<F>::relocate(void* dst, void* src) {
+    new (dst) F*(*static_cast<F**>(src));
+}
+
+template <std::size_t InlineSize>
+template <typename F>
+void BasicTask<InlineSize>::HeapOps<F>::destroy(void* storage) {
+    delete *static_cast<F**>(storage);
+}
+
+/*****************************************************************************/
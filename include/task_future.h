@@ -0,0 +1,649 @@
+/**
+ * @file        task_future.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-30>
+ * @version     1.0.0
+ *
+ * @brief       Lightweight single-allocation future for tasks submitted to the WorkerPool.
+ *
+ * @details
+ * `std::packaged_task` + `std::future` costs two allocations per task (the shared state
+ * and the type-erased callable) plus a mutex and condition variable per state.
+ * `TaskFuture<R>` keeps everything in **one** heap block, `TaskFutureBinding`, which holds:
+ *  - the user callable and its bound arguments,
+ *  - the result slot (`R`, or nothing for `void`) and an `std::exception_ptr`,
+ *  - an intrusive reference count shared by the future and the queued task.
+ *
+ * The task side is a pointer-sized `TaskFutureRunner<R>`, so it always fits inline in a
+ * `Task`. Waiting uses a small process-wide table of striped mutex/condition-variable
+ * pairs; a completing task only touches it when somebody is actually blocked on `get()`.
+ *
+ * If the task is destroyed without running (e.g. the queue was closed), the future
+ * receives a `std::future_error` with `std::future_errc::broken_promise`.
+ *
+ * Composition never blocks a thread:
+ *  - `then(executor, f)` submits `f(result)` to the executor from the thread that
+ *    completes the antecedent;
+ *  - `when_all()` / `when_any()` count completions through continuations and become
+ *    ready on the thread that completes the last (or first) input.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @brief Result type of invoking a decayed copy of `F` with decayed copies of `Args...`.
+ */
+template <typename F, typename... Args>
+using TaskResultOf = typename std::result_of<typename std::decay<F>::type(
+    typename std::decay<Args>::type...)>::type;
+
+/**
+ * @brief Result type of a continuation `F` receiving the value of a `TaskFuture<R>`.
+ */
+template <typename R, typename F>
+struct ContinuationResult
+{
+    using type = typename std::result_of<typename std::decay<F>::type(R)>::type;
+};
+
+/**
+ * @brief `ContinuationResult` for `void` antecedents: `F` takes no argument.
+ */
+template <typename F>
+struct ContinuationResult<void, F>
+{
+    using type = typename std::result_of<typename std::decay<F>::type()>::type;
+};
+
+/*****************************************************************************/
+
+/**
+ * @class TaskFutureStateBase
+ * @brief Type-independent part of the shared state: reference count, readiness and waiting.
+ */
+class TaskFutureStateBase
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Adds one owner.
+     */
+    void retain() noexcept;
+
+    /**
+     * @brief Drops one owner and destroys the state when it was the last one.
+     */
+    void release() noexcept;
+
+    /**
+     * @brief Returns `true` once the result or exception has been stored.
+     */
+    bool is_ready() const noexcept;
+
+    /**
+     * @brief Blocks until the state is ready.
+     */
+    void wait() const;
+
+    /**
+     * @brief Blocks until the state is ready or `timeout` elapses.
+     *
+     * @return `true` if the state became ready.
+     */
+    template <typename Rep, typename Period>
+    bool wait_for(const std::chrono::duration<Rep, Period>& timeout) const;
+
+    /**
+     * @brief Stores a `broken_promise` error (the task was dropped before running).
+     */
+    void abandon();
+
+    /**
+     * @brief Registers `callback` to run once the state is ready.
+     *
+     * @details
+     * GIVEN a state that is not ready yet,
+     * WHEN the callback is registered,
+     * THEN it runs on the thread that completes the state, right after the waiters
+     * are woken; if the state is already ready it runs immediately on the caller.
+     *
+     * @note
+     * At most one callback per state; registering is lock-free.
+     */
+    void set_continuation(Task callback);
+
+    /**
+     * @brief Returns `true` while a registered callback has not run yet.
+     *
+     * @details
+     * `set_continuation()` throws exactly when this returns `true`.
+     */
+    bool has_continuation() const noexcept;
+
+    /**
+     * @brief Drops a registered callback that has not run yet.
+     *
+     * @return `true` if a callback was removed; `false` if there was none or the state
+     *         became ready (and ran it) first.
+     *
+     * @details
+     * Decided by the same compare-exchange as `set_continuation()`, so the callback
+     * either runs exactly once or is destroyed without running.
+     */
+    bool clear_continuation() noexcept;
+
+    /**
+     * @brief Runs the bound callable and stores its outcome.
+     */
+    virtual void run() = 0;
+
+    /******************************************************************/
+
+    /* Protected Methods */
+
+   protected:
+    TaskFutureStateBase() = default;
+
+    /**
+     * @brief Frees a callback that never ran.
+     */
+    virtual ~TaskFutureStateBase();
+
+    /**
+     * @brief Publishes readiness and wakes blocked waiters, if any.
+     */
+    void make_ready();
+
+    /**
+     * @brief Rethrows the stored exception, if any.
+     */
+    void rethrow_if_failed() const;
+
+    /******************************************************************/
+
+    /* Protected Attributes */
+
+   protected:
+    /**
+     * @brief Exception thrown by the callable (or `broken_promise`).
+     */
+    std::exception_ptr error;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @struct WaitSlot
+     * @brief One stripe of the shared waiting table.
+     */
+    struct WaitSlot
+    {
+        std::mutex              mtx;
+        std::condition_variable cv;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Returns the waiting stripe assigned to this state.
+     */
+    WaitSlot& wait_slot() const;
+
+    /**
+     * @brief Marker stored in `continuation` once the state is ready.
+     */
+    static Task* fired_marker() noexcept;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+   private:
+    /**
+     * @brief Number of stripes in the shared waiting table.
+     */
+    static constexpr std::size_t WAIT_SLOTS = 16;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Owners: the future and the queued task.
+     */
+    std::atomic<int> refs{1};
+
+    /**
+     * @brief Set once the outcome is stored.
+     */
+    std::atomic<bool> ready{false};
+
+    /**
+     * @brief Number of threads blocked in `wait()` / `wait_for()`.
+     */
+    mutable std::atomic<int> waiters{0};
+
+    /**
+     * @brief Registered callback, `nullptr`, or `fired_marker()` once ready.
+     *
+     * @details
+     * Only allocated when a continuation is used, so plain futures stay small.
+     */
+    std::atomic<Task*> continuation{nullptr};
+
+    /******************************************************************/
+};
+
+/**
+ * @class TaskFutureState
+ * @brief Shared state holding the result of type `R`.
+ *
+ * @tparam R Result type (may be `void` or an lvalue reference).
+ */
+template <typename R>
+class TaskFutureState : public TaskFutureStateBase
+{
+   public:
+    /**
+     * @brief Moves the result out, or rethrows the stored exception.
+     */
+    R take();
+
+   protected:
+    /**
+     * @brief Invokes `fn` and stores its return value or exception, then marks ready.
+     */
+    template <typename Fn>
+    void complete(Fn&& fn);
+
+   private:
+    nonstd::optional<R> value;
+};
+
+/**
+ * @brief `TaskFutureState` specialization for reference results (stores a pointer).
+ */
+template <typename R>
+class TaskFutureState<R&> : public TaskFutureStateBase
+{
+   public:
+    R& take();
+
+   protected:
+    template <typename Fn>
+    void complete(Fn&& fn);
+
+   private:
+    R* value = nullptr;
+};
+
+/**
+ * @brief `TaskFutureState` specialization for callables returning `void`.
+ */
+template <>
+class TaskFutureState<void> : public TaskFutureStateBase
+{
+   public:
+    void take();
+
+   protected:
+    template <typename Fn>
+    void complete(Fn&& fn);
+};
+
+/**
+ * @class TaskFutureBinding
+ * @brief Single heap block combining the shared state with the callable and its arguments.
+ *
+ * @tparam R    Result type.
+ * @tparam F    Decayed callable type.
+ * @tparam Args Decayed argument types.
+ */
+template <typename R, typename F, typename... Args>
+class TaskFutureBinding final : public TaskFutureState<R>
+{
+   public:
+    template <typename G, typename... As>
+    explicit TaskFutureBinding(G&& fn, As&&... as);
+
+    void run() override;
+
+   private:
+    template <std::size_t... I>
+    R invoke(std::index_sequence<I...>);
+
+    F                   fn;
+    std::tuple<Args...> args;
+};
+
+/*****************************************************************************/
+
+/**
+ * @class TaskFutureRunner
+ * @brief Pointer-sized callable stored in the `Task`; runs the bound state once.
+ *
+ * @details
+ * Holds one reference to the shared state. If destroyed before being invoked,
+ * it abandons the state so that the future reports `broken_promise`.
+ */
+template <typename R>
+class TaskFutureRunner
+{
+   public:
+    explicit TaskFutureRunner(TaskFutureState<R>* state) noexcept;
+
+    TaskFutureRunner(TaskFutureRunner&& other) noexcept;
+
+    TaskFutureRunner(const TaskFutureRunner&) = delete;
+
+    TaskFutureRunner& operator=(const TaskFutureRunner&) = delete;
+
+    TaskFutureRunner& operator=(TaskFutureRunner&&) = delete;
+
+    ~TaskFutureRunner();
+
+    void operator()();
+
+   private:
+    TaskFutureState<R>* state;
+};
+
+/*****************************************************************************/
+
+/**
+ * @class TaskFuture
+ * @brief Move-only handle to the eventual result of a submitted task.
+ *
+ * @tparam R Result type of the task.
+ *
+ * @details
+ * Mirrors the subset of `std::future` used in practice: `valid()`, `wait()`,
+ * `wait_for()` and a one-shot `get()` that returns the value or rethrows the
+ * task's exception.
+ */
+template <typename R>
+class TaskFuture
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty future (`valid() == false`).
+     */
+    TaskFuture() noexcept = default;
+
+    /**
+     * @brief Adopts one reference to `state`.
+     */
+    explicit TaskFuture(TaskFutureState<R>* state) noexcept;
+
+    /**
+     * @brief Move constructor; leaves `other` invalid.
+     */
+    TaskFuture(TaskFuture&& other) noexcept;
+
+    /**
+     * @brief Move assignment; releases the current state and leaves `other` invalid.
+     */
+    TaskFuture& operator=(TaskFuture&& other) noexcept;
+
+    /**
+     * @brief Deleted copy constructor (the result can only be retrieved once).
+     */
+    TaskFuture(const TaskFuture&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    TaskFuture& operator=(const TaskFuture&) = delete;
+
+    /**
+     * @brief Releases the shared state.
+     */
+    ~TaskFuture();
+
+    /**
+     * @brief Returns `true` if the future refers to a shared state.
+     */
+    bool valid() const noexcept { return state != nullptr; }
+
+    /**
+     * @brief Returns `true` if the result (or exception) is available.
+     *
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    bool is_ready() const;
+
+    /**
+     * @brief Blocks until the result is available.
+     *
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    void wait() const;
+
+    /**
+     * @brief Blocks until the result is available or `timeout` elapses.
+     *
+     * @return `std::future_status::ready` or `std::future_status::timeout`.
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    template <typename Rep, typename Period>
+    std::future_status wait_for(const std::chrono::duration<Rep, Period>& timeout) const;
+
+    /**
+     * @brief Waits for the result and returns it, rethrowing the task's exception if any.
+     *
+     * @details
+     * The future becomes invalid after this call.
+     *
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    R get();
+
+    /**
+     * @brief Schedules `f(result)` on `executor` once this future is ready.
+     *
+     * @tparam Executor Anything with `submit(Task)` (`WorkerPool`, `Strand`, ...).
+     * @param executor Receives the continuation task; must outlive it.
+     * @param f        Called with the result (no argument for `void` futures).
+     * @return Future of `f`'s result. If this future holds an exception, `f` is not
+     *         called and the exception is forwarded.
+     *
+     * @details
+     * GIVEN a future whose task is still running,
+     * WHEN `then()` is called,
+     * THEN nothing blocks: the thread completing the task submits the continuation.
+     * This future becomes invalid; its result is handed to `f`.
+     *
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    template <typename Executor, typename F>
+    TaskFuture<typename ContinuationResult<R, F>::type> then(Executor& executor, F&& f);
+
+    /**
+     * @brief Runs `callback` once the result is available, without consuming it.
+     *
+     * @details
+     * Low-level hook used by `then()`, `when_all()` and `when_any()`; `callback` runs
+     * on the completing thread (or right away if already ready) and must be short.
+     * At most one callback can be registered per future.
+     *
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    void on_ready(Task callback);
+
+    /**
+     * @brief Returns `true` if a callback registered with `on_ready()` is still pending.
+     *
+     * @details
+     * `on_ready()` throws `future_already_retrieved` exactly when this returns `true`.
+     *
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    bool has_continuation() const;
+
+    /**
+     * @brief Removes the `on_ready()` callback if it has not run yet.
+     *
+     * @return `true` if a pending callback was removed, so a new one can be registered.
+     *
+     * @throws std::future_error (`no_state`) if the future is invalid.
+     */
+    bool detach_on_ready();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Throws `std::future_error(no_state)` when the future is invalid.
+     */
+    void check_state() const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Shared state, or `nullptr` when invalid.
+     */
+    TaskFutureState<R>* state = nullptr;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @class TaskContinuation
+ * @brief Callable run by a `then()` continuation: unwraps the antecedent, calls `fn`.
+ */
+template <typename R, typename F>
+struct TaskContinuation
+{
+    TaskFuture<R> antecedent; /**< Ready future whose value is handed over. */
+    F             fn;         /**< User continuation. */
+
+    typename ContinuationResult<R, F>::type operator()() { return fn(antecedent.get()); }
+};
+
+/**
+ * @brief `TaskContinuation` for `void` antecedents.
+ */
+template <typename F>
+struct TaskContinuation<void, F>
+{
+    TaskFuture<void> antecedent; /**< Ready future, checked for an exception. */
+    F                fn;         /**< User continuation. */
+
+    typename ContinuationResult<void, F>::type operator()() {
+        antecedent.get();
+        return fn();
+    }
+};
+
+/**
+ * @struct WhenAnyResult
+ * @brief Value of the future returned by `when_any()`.
+ */
+template <typename R>
+struct WhenAnyResult
+{
+    std::size_t                index;   /**< Input that completed first (`-1` if none). */
+    std::vector<TaskFuture<R>> futures; /**< All inputs, in their original order. */
+};
+
+/*****************************************************************************/
+
+/**
+ * @brief Packages `f(args...)` into a `Task` and the `TaskFuture` observing its result.
+ *
+ * @param f    Callable to run.
+ * @param args Arguments bound to the call (decay-copied or moved).
+ * @return The runnable task and its future; the shared state is a single allocation.
+ */
+template <typename F, typename... Args>
+std::pair<Task, TaskFuture<TaskResultOf<F, Args...>>> make_future_task(F&& f, Args&&... args);
+
+/**
+ * @brief Checks that every input of a combinator can take an `on_ready()` callback.
+ *
+ * @throws std::future_error (`no_state`) for an invalid input, or
+ *         (`future_already_retrieved`) for an input that already has a callback.
+ */
+template <typename R>
+void check_combinable(const std::vector<TaskFuture<R>>& futures);
+
+/**
+ * @brief Returns a future that becomes ready once every input is ready.
+ *
+ * @param futures Inputs (all valid); they are moved into the result.
+ * @return Future of the inputs, all ready, so each value or exception can be taken.
+ * @throws std::future_error (`no_state` or `future_already_retrieved`) if an input is
+ *         invalid or already has an `on_ready()` callback; no callback is installed then.
+ *
+ * @details
+ * GIVEN futures of tasks still running on a pool,
+ * WHEN `when_all()` is called,
+ * THEN it returns immediately and no thread waits: the task that completes last
+ * makes the result ready. An empty input gives an already ready future.
+ */
+template <typename R>
+TaskFuture<std::vector<TaskFuture<R>>> when_all(std::vector<TaskFuture<R>> futures);
+
+/**
+ * @brief Returns a future that becomes ready as soon as one input is ready.
+ *
+ * @param futures Inputs (all valid); they are moved into the result.
+ * @return Index of the first ready input and all inputs (the others may still run).
+ *         The callbacks `when_any()` attached to the other inputs are removed first, so
+ *         they can be combined again or chained with `then()`.
+ * @throws std::future_error Same as `when_all()`.
+ */
+template <typename R>
+TaskFuture<WhenAnyResult<R>> when_any(std::vector<TaskFuture<R>> futures);
+
+#include "task_future.ipp"
@@ -0,0 +1,517 @@
+/**
+ * @file        task_future.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-30>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of TaskFuture and its shared state.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstdint>
+
+/* Project libraries */
+
+#include "task_future.h"
+
+/*****************************************************************************/
+
+/* TaskFutureStateBase */
+
+inline void TaskFutureStateBase::retain() noexcept {
+    refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void TaskFutureStateBase::release() noexcept {
+    if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+}
+
+inline bool TaskFutureStateBase::is_ready() const noexcept {
+    return ready.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Blocks until the state is ready.
+ *
+ * @details
+ * The waiter registers itself in `waiters` before checking `ready` under the stripe
+ * mutex; `make_ready()` stores `ready` before reading `waiters`. Both sides use
+ * sequentially consistent operations, so at least one of them observes the other and
+ * a wake-up can never be lost.
+ */
+inline void TaskFutureStateBase::wait() const {
+    if (is_ready()) return;
+
+    WaitSlot& slot = wait_slot();
+    waiters.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(slot.mtx);
+        slot.cv.wait(lock, [this] { return ready.load(); });
+    }
+    waiters.fetch_sub(1);
+}
+
+template <typename Rep, typename Period>
+bool TaskFutureStateBase::wait_for(const std::chrono::duration<Rep, Period>& timeout) const {
+    if (is_ready()) return true;
+
+    WaitSlot& slot = wait_slot();
+    bool      done;
+    waiters.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(slot.mtx);
+        done = slot.cv.wait_for(lock, timeout, [this] { return ready.load(); });
+    }
+    waiters.fetch_sub(1);
+    return done;
+}
+
+inline void TaskFutureStateBase::abandon() {
+    error = std::make_exception_ptr(std::future_error(std::future_errc::broken_promise));
+    make_ready();
+}
+
+/**
+ * @brief Installs the callback, or runs it if the state became ready first.
+ *
+ * @details
+ * The exchange in `make_ready()` and the compare-exchange here decide the race:
+ * exactly one side sees the other's value and that side runs the callback.
+ */
+inline void TaskFutureStateBase::set_continuation(Task callback) {
+    Task* installed = new Task(std::move(callback));
+    Task* expected  = nullptr;
+    if (continuation.compare_exchange_strong(expected, installed)) return;
+
+    std::unique_ptr<Task> owned(installed);
+    if (expected != fired_marker())
+        throw std::future_error(std::future_errc::future_already_retrieved);
+    (*owned)();
+}
+
+inline bool TaskFutureStateBase::has_continuation() const noexcept {
+    const Task* pending = continuation.load();
+    return pending != nullptr && pending != fired_marker();
+}
+
+inline bool TaskFutureStateBase::clear_continuation() noexcept {
+    Task* pending = continuation.load();
+    if (pending == nullptr || pending == fired_marker()) return false;
+    if (!continuation.compare_exchange_strong(pending, nullptr)) return false;
+
+    delete pending;
+    return true;
+}
+
+inline TaskFutureStateBase::~TaskFutureStateBase() {
+    Task* pending = continuation.load(std::memory_order_relaxed);
+    if (pending != nullptr && pending != fired_marker()) delete pending;
+}
+
+/**
+ * @brief Publishes readiness, wakes blocked waiters, then runs the continuation.
+ *
+ * @details
+ * The waiting stripe is only touched if somebody is blocked. The continuation runs
+ * last, after the outcome is visible to everybody.
+ */
+inline void TaskFutureStateBase::make_ready() {
+    ready.store(true);
+    if (waiters.load() != 0) {
+        WaitSlot& slot = wait_slot();
+        {
+            std::lock_guard<std::mutex> lock(slot.mtx);
+        }
+        slot.cv.notify_all();
+    }
+
+    Task* callback = continuation.exchange(fired_marker());
+    if (callback == nullptr) return;
+
+    std::unique_ptr<Task> owned(callback);
+    (*owned)();
+}
+
+inline void TaskFutureStateBase::rethrow_if_failed() const {
+    if (error) std::rethrow_exception(error);
+}
+
+/**
+ * @brief Maps the state address onto one of `WAIT_SLOTS` shared stripes.
+ */
+inline TaskFutureStateBase::WaitSlot& TaskFutureStateBase::wait_slot() const {
+    static WaitSlot slots[WAIT_SLOTS];
+    const auto      addr = reinterpret_cast<std::uintptr_t>(this);
+    return slots[(addr / alignof(std::max_align_t)) % WAIT_SLOTS];
+}
+
+inline Task* TaskFutureStateBase::fired_marker() noexcept {
+    static Task marker;
+    return &marker;
+}
+
+/*****************************************************************************/
+
+/* TaskFutureState */
+
+template <typename R>
+R TaskFutureState<R>::take() {
+    rethrow_if_failed();
+    return std::move(*value);
+}
+
+template <typename R>
+template <typename Fn>
+void TaskFutureState<R>::complete(Fn&& fn) {
+    try {
+        value.emplace(std::forward<Fn>(fn)());
+    } catch (...) {
+        error = std::current_exception();
+    }
+    make_ready();
+}
+
+template <typename R>
+R& TaskFutureState<R&>::take() {
+    rethrow_if_failed();
+    return *value;
+}
+
+template <typename R>
+template <typename Fn>
+void TaskFutureState<R&>::complete(Fn&& fn) {
+    try {
+        value = &std::forward<Fn>(fn)();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    make_ready();
+}
+
+inline void TaskFutureState<void>::take() {
+    rethrow_if_failed();
+}
+
+template <typename Fn>
+void TaskFutureState<void>::complete(Fn&& fn) {
+    try {
+        std::forward<Fn>(fn)();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    make_ready();
+}
+
+/*****************************************************************************/
+
+/* TaskFutureBinding */
+
+template <typename R, typename F, typename... Args>
+template <typename G, typename... As>
+TaskFutureBinding<R, F, Args...>::TaskFutureBinding(G&& fn, As&&... as)
+    : fn(std::forward<G>(fn)), args(std::forward<As>(as)...) {}
+
+template <typename R, typename F, typename... Args>
+void TaskFutureBinding<R, F, Args...>::run() {
+    this->complete([this]() -> R { return invoke(std::index_sequence_for<Args...>{}); });
+}
+
+template <typename R, typename F, typename... Args>
+template <std::size_t... I>
+R TaskFutureBinding<R, F, Args...>::invoke(std::index_sequence<I...>) {
+    return std::move(fn)(std::get<I>(std::move(args))...);
+}
+
+/*****************************************************************************/
+
+/* TaskFutureRunner */
+
+template <typename R>
+TaskFutureRunner<R>::TaskFutureRunner(TaskFutureState<R>* state) noexcept : state(state) {
+    state->retain();
+}
+
+template <typename R>
+TaskFutureRunner<R>::TaskFutureRunner(TaskFutureRunner&& other) noexcept : state(other.state) {
+    other.state = nullptr;
+}
+
+/**
+ * @brief Releases the state, reporting `broken_promise` if the task never ran.
+ */
+template <typename R>
+TaskFutureRunner<R>::~TaskFutureRunner() {
+    if (state == nullptr) return;
+    if (!state->is_ready()) state->abandon();
+    state->release();
+}
+
+template <typename R>
+void TaskFutureRunner<R>::operator()() {
+    state->run();
+}
+
+/*****************************************************************************/
+
+/* TaskFuture */
+
+template <typename R>
+TaskFuture<R>::TaskFuture(TaskFutureState<R>* state) noexcept : state(state) {}
+
+template <typename R>
+TaskFuture<R>::TaskFuture(TaskFuture&& other) noexcept : state(other.state) {
+    other.state = nullptr;
+}
+
+template <typename R>
+TaskFuture<R>& TaskFuture<R>::operator=(TaskFuture&& other) noexcept {
+    if (this != &other) {
+        if (state != nullptr) state->release();
+        state       = other.state;
+        other.state = nullptr;
+    }
+    return *this;
+}
+
+template <typename R>
+TaskFuture<R>::~TaskFuture() {
+    if (state != nullptr) state->release();
+}
+
+template <typename R>
+bool TaskFuture<R>::is_ready() const {
+    check_state();
+    return state->is_ready();
+}
+
+template <typename R>
+void TaskFuture<R>::wait() const {
+    check_state();
+    state->wait();
+}
+
+template <typename R>
+template <typename Rep, typename Period>
+std::future_status TaskFuture<R>::wait_for(
+    const std::chrono::duration<Rep, Period>& timeout) const {
+    check_state();
+    return state->wait_for(timeout) ? std::future_status::ready : std::future_status::timeout;
+}
+
+/**
+ * @brief Waits for completion, then hands over the result and invalidates the future.
+ *
+ * @details
+ * GIVEN a future returned by `WorkerPool::submit(f, args...)`,
+ * WHEN `get()` is called,
+ * THEN it returns `f(args...)` or rethrows the exception `f` threw.
+ */
+template <typename R>
+R TaskFuture<R>::get() {
+    check_state();
+    state->wait();
+
+    TaskFutureState<R>* owned = state;
+    state                     = nullptr;
+
+    struct Release
+    {
+        TaskFutureState<R>* ptr;
+        ~Release() { ptr->release(); }
+    } guard{owned};
+
+    return owned->take();
+}
+
+/**
+ * @brief Builds the continuation's state and hooks its runner onto this future.
+ *
+ * @details
+ * The continuation binding owns this future's state (through `TaskContinuation`), and
+ * the callback registered on that state only holds a pointer-sized runner, so the
+ * whole chain link costs the binding plus one small callback allocation.
+ */
+template <typename R>
+template <typename Executor, typename F>
+TaskFuture<typename ContinuationResult<R, F>::type> TaskFuture<R>::then(Executor& executor,
+                                                                        F&&       f) {
+    using Next    = typename ContinuationResult<R, F>::type;
+    using Call    = TaskContinuation<R, typename std::decay<F>::type>;
+    using Binding = TaskFutureBinding<Next, Call>;
+
+    check_state();
+    TaskFutureState<R>* antecedent = state;
+
+    auto*            binding = new Binding(Call{std::move(*this), std::forward<F>(f)});
+    TaskFuture<Next> next(binding);
+
+    antecedent->set_continuation(
+        Task([&executor, runner = TaskFutureRunner<Next>(binding)]() mutable {
+            executor.submit(Task(std::move(runner)));
+        }));
+    return next;
+}
+
+template <typename R>
+void TaskFuture<R>::on_ready(Task callback) {
+    check_state();
+    state->set_continuation(std::move(callback));
+}
+
+template <typename R>
+bool TaskFuture<R>::has_continuation() const {
+    check_state();
+    return state->has_continuation();
+}
+
+template <typename R>
+bool TaskFuture<R>::detach_on_ready() {
+    check_state();
+    return state->clear_continuation();
+}
+
+template <typename R>
+void TaskFuture<R>::check_state() const {
+    if (state == nullptr) throw std::future_error(std::future_errc::no_state);
+}
+
+/*****************************************************************************/
+
+/* Factory */
+
+/**
+ * @brief Allocates one `TaskFutureBinding` and splits it into a task and a future.
+ *
+ * @details
+ * The binding starts with one reference, adopted by the future; the runner stored in
+ * the task takes the second one.
+ */
+template <typename F, typename... Args>
+std::pair<Task, TaskFuture<TaskResultOf<F, Args...>>> make_future_task(F&& f, Args&&... args) {
+    using R       = TaskResultOf<F, Args...>;
+    using Binding = TaskFutureBinding<R, typename std::decay<F>::type,
+                                      typename std::decay<Args>::type...>;
+
+    auto*         state = new Binding(std::forward<F>(f), std::forward<Args>(args)...);
+    TaskFuture<R> future(state);
+    Task          task{TaskFutureRunner<R>(state)};
+    return std::make_pair(std::move(task), std::move(future));
+}
+
+/*****************************************************************************/
+
+/* Combinators */
+
+/**
+ * @brief Validates every input before a combinator installs its first callback.
+ *
+ * @details
+ * `on_ready()` throwing halfway through the attach loop would leave the earlier
+ * callbacks installed, each holding the combinator's shared state: the inputs own
+ * the callbacks, the shared state owns the inputs, and the cycle never frees.
+ * The inputs were moved into the combinator, so nobody else can attach a callback
+ * between this check and the loop.
+ */
+template <typename R>
+void check_combinable(const std::vector<TaskFuture<R>>& futures) {
+    for (const auto& future : futures) {
+        if (!future.valid()) throw std::future_error(std::future_errc::no_state);
+        if (future.has_continuation())
+            throw std::future_error(std::future_errc::future_already_retrieved);
+    }
+}
+
+/**
+ * @brief Counts down one continuation per input; the last one completes the result.
+ *
+ * @details
+ * The counter starts at `size() + 1`: the extra unit is released after every
+ * continuation is attached, so an input that is already ready cannot complete the
+ * result (and move the inputs away) while they are still being iterated.
+ */
+template <typename R>
+TaskFuture<std::vector<TaskFuture<R>>> when_all(std::vector<TaskFuture<R>> futures) {
+    struct Shared
+    {
+        std::vector<TaskFuture<R>> futures;
+        std::atomic<std::size_t>   left;
+        Task                       finish;
+    };
+
+    check_combinable(futures);
+
+    auto shared     = std::make_shared<Shared>();
+    shared->futures = std::move(futures);
+    shared->left.store(shared->futures.size() + 1);
+
+    auto packaged  = make_future_task([shared] { return std::move(shared->futures); });
+    shared->finish = std::move(packaged.first);
+
+    auto arrive = [](const std::shared_ptr<Shared>& all) {
+        if (all->left.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        Task finish = std::move(all->finish);
+        finish();
+    };
+
+    for (auto& future : shared->futures)
+        future.on_ready(Task([shared, arrive] { arrive(shared); }));
+    arrive(shared);
+    return std::move(packaged.second);
+}
+
+/**
+ * @brief The first ready input claims the result; the attach loop holds it back.
+ *
+ * @details
+ * `gate` starts at 2: one unit is released by the winning continuation, the other
+ * after the attach loop, and whoever releases the last one completes the result.
+ * At that point every callback is attached, so the losers' ones are detached before
+ * the inputs are handed back; a loser completing concurrently either runs its
+ * callback (which sees `claimed` and returns) or has it removed, never both.
+ */
+template <typename R>
+TaskFuture<WhenAnyResult<R>> when_any(std::vector<TaskFuture<R>> futures) {
+    struct Shared
+    {
+        std::vector<TaskFuture<R>> futures;
+        std::size_t                index = static_cast<std::size_t>(-1);
+        std::atomic<bool>          claimed{false};
+        std::atomic<int>           gate{2};
+        Task                       finish;
+    };
+
+    check_combinable(futures);
+
+    auto shared     = std::make_shared<Shared>();
+    shared->futures = std::move(futures);
+
+    auto packaged = make_future_task([shared] {
+        return WhenAnyResult<R>{shared->index, std::move(shared->futures)};
+    });
+    shared->finish = std::move(packaged.first);
+
+    auto release = [](const std::shared_ptr<Shared>& any) {
+        if (any->gate.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        for (std::size_t j = 0; j < any->futures.size(); j++)
+            if (j != any->index) any->futures[j].detach_on_ready();
+        Task finish = std::move(any->finish);
+        finish();
+    };
+
+    const std::size_t count = shared->futures.size();
+    for (std::size_t i = 0; i < count; i++) {
+        shared->futures[i].on_ready(Task([shared, release, i] {
+            if (shared->claimed.exchange(true)) return;
+            shared->index = i;
+            release(shared);
+        }));
+    }
+    if (count == 0) release(shared);
+    release(shared);
+    return std::move(packaged.second);
+}
+
+/*****************************************************************************/
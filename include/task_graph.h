@@ -0,0 +1,256 @@
+/**
+ * @file        task_graph.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-13>
+ * @version     1.0.0
+ *
+ * @brief       Directed acyclic graph of tasks executed on a WorkerPool.
+ *
+ * @details
+ * Nodes are tasks, edges are "runs before" constraints. Each node keeps an atomic
+ * count of unfinished predecessors:
+ *  - `start()` resets every count and submits the nodes without predecessors;
+ *  - a finishing node decrements the count of each successor; the successors that
+ *    reach zero are ready: the first one runs right away on the same worker and the
+ *    others are submitted to the pool;
+ *  - `wait()` returns when every node has finished.
+ *
+ * There is no barrier between stages: a node starts as soon as its own inputs are
+ * done. If the pool rejects a node (its queue is closed because it is stopping), the
+ * run fails: the node and everything still pending are skipped on the thread that
+ * saw the rejection, and `wait()` throws.
+ *
+ * Nodes and edges stay allocated between runs, so a finished graph is re-run by
+ * calling `start()` (or `run()`) again.
+ *
+ * Example:
+ * ```cpp
+ * TaskGraph graph;
+ * auto load  = graph.add_node([] { load_input(); });
+ * auto left  = graph.add_node([] { transform_left(); });
+ * auto right = graph.add_node([] { transform_right(); });
+ * auto merge = graph.add_node([] { merge_outputs(); });
+ * graph.add_edge(load, left);
+ * graph.add_edge(load, right);
+ * graph.add_edge(left, merge);
+ * graph.add_edge(right, merge);
+ * graph.run(pool);   // left and right run in parallel, merge after both
+ * ```
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+/* Project libraries */
+
+#include "task.h"
+#include "worker_pool.h"
+
+/*****************************************************************************/
+
+/**
+ * @class TaskGraph
+ * @brief Re-runnable DAG of tasks dispatched to a WorkerPool as their inputs finish.
+ *
+ * @details
+ * The graph must not be modified or destroyed while a run is in progress; the
+ * destructor waits for a running graph to finish. The pool must have started workers.
+ */
+class TaskGraph
+{
+    /******************************************************************/
+
+    /* Public Types */
+
+   public:
+    /**
+     * @brief Identifier of a node, returned by `add_node()`.
+     */
+    using NodeId = std::size_t;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty graph.
+     */
+    TaskGraph();
+
+    /**
+     * @brief Waits for a run in progress, if any.
+     */
+    ~TaskGraph();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    TaskGraph(const TaskGraph&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /**
+     * @brief Adds a node running `task` once per run.
+     *
+     * @return Identifier used by `add_edge()`.
+     *
+     * @throws std::logic_error if the graph is running.
+     */
+    NodeId add_node(Task task);
+
+    /**
+     * @brief Makes `to` wait for `from` in every run.
+     *
+     * @throws std::out_of_range if either node does not exist.
+     * @throws std::invalid_argument if `from == to`.
+     * @throws std::logic_error if the graph is running.
+     */
+    void add_edge(NodeId from, NodeId to);
+
+    /**
+     * @brief Starts a run on `pool` and returns immediately.
+     *
+     * @details
+     * GIVEN a finished (or never run) graph,
+     * WHEN `start()` is called,
+     * THEN every predecessor count is reset in place and the nodes without
+     * predecessors are submitted to `pool`.
+     *
+     * @throws std::logic_error if the graph is already running or contains a cycle
+     *         (checked once after each modification).
+     */
+    void start(WorkerPool& pool);
+
+    /**
+     * @brief Blocks until the current run has finished.
+     *
+     * @details
+     * Rethrows the first exception thrown by a node, or a `std::runtime_error` if the
+     * pool rejected a node. Once a node has failed, the nodes that have not started
+     * yet are skipped (their dependents still count down, so the run always completes).
+     *
+     * @throws std::runtime_error if the pool rejected a node (e.g. it was stopped).
+     */
+    void wait();
+
+    /**
+     * @brief `start(pool)` followed by `wait()`.
+     */
+    void run(WorkerPool& pool);
+
+    /**
+     * @brief Returns the number of nodes.
+     */
+    std::size_t size() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Node storage; lives in a `std::deque`, so its address is stable.
+     */
+    struct Node
+    {
+        explicit Node(Task task) : task(std::move(task)) {}
+
+        Task                     task;             /**< Work of the node. */
+        std::vector<NodeId>      successors;       /**< Nodes waiting for this one. */
+        std::size_t              predecessors = 0; /**< Number of incoming edges. */
+        std::atomic<std::size_t> pending{0};       /**< Predecessors left in this run. */
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Throws `std::logic_error` if the graph contains a cycle.
+     */
+    void validate() const;
+
+    /**
+     * @brief Submits node `id` to the pool of the current run.
+     *
+     * @return `false` if the pool rejected it; the run is then marked failed and the
+     *         caller must execute the node itself so its dependents still count down.
+     */
+    bool dispatch(NodeId id);
+
+    /**
+     * @brief Runs node `id`, then every ready successor it keeps on this thread.
+     */
+    void execute(NodeId id);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Nodes in creation order.
+     */
+    std::deque<Node> nodes;
+
+    /**
+     * @brief `true` once the current shape has been checked for cycles.
+     */
+    bool validated;
+
+    /**
+     * @brief Pool of the current run.
+     */
+    WorkerPool* pool;
+
+    /**
+     * @brief Nodes not finished in the current run.
+     */
+    std::atomic<std::size_t> remaining;
+
+    /**
+     * @brief Set once a node has thrown in the current run.
+     */
+    std::atomic<bool> failed;
+
+    /**
+     * @brief Protects `running` and `error`.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Signalled when the last node of a run finishes.
+     */
+    std::condition_variable done_cv;
+
+    /**
+     * @brief `true` between `start()` and the end of the run.
+     */
+    bool running;
+
+    /**
+     * @brief First exception thrown by a node in the current run.
+     */
+    std::exception_ptr error;
+
+    /******************************************************************/
+};
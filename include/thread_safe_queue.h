@@ -10,9 +10,14 @@
  * This class provides a minimal and efficient thread-safe FIFO queue based on
  * `std::deque`, `std::mutex`, and `std::condition_variable`.
  *
- * It supports both blocking (`pop`) and non-blocking (`try_pop`) access patterns,
- * and provides a `close()` mechanism for graceful shutdown, allowing waiting threads
- * to exit cleanly when the queue is being destroyed or stopped.
+ * It supports blocking (`pop`), timed (`pop_for`, `pop_until`) and non-blocking
+ * (`try_pop`) access patterns, and provides a `close()` mechanism for graceful
+ * shutdown, allowing waiting threads to exit cleanly when the queue is being
+ * destroyed or stopped.
+ *
+ * The queue is unbounded by default. When constructed with a non-zero capacity it
+ * applies **producer backpressure**: `push()` blocks while the queue is full,
+ * `try_push()` fails immediately and `push_for()` gives up after a timeout.
  *
  * The queue follows a producer-consumer design pattern, ensuring that:
  *  - Multiple producers can push elements concurrently.
@@ -22,6 +27,13 @@
  * The class is intentionally **non-copyable** and **non-movable**, as it manages
  * synchronization primitives (`std::mutex`, `std::condition_variable`) that cannot be
  * transferred safely between instances.
+ *
+ * This header defines the default `MutexBackend` implementation. Other backends
+ * (see `queue_backends.h`) expose the same interface and are selected through the
+ * second template parameter, e.g. `ThreadSafeQueue<T, MpmcRingBackend>`.
+ *
+ * Diagnostics are routed through the third template parameter, a tracing policy
+ * (`NoQueueTrace` by default, see `queue_trace.h`).
  */
 
 /*****************************************************************************/
@@ -33,13 +45,13 @@
 
 /* Standard libraries */
 
-#include <condition_variable>
+#include <cstddef>
 #include <deque>
-#include <mutex>
 
-/* Third party libraries */
+/* Project libraries */
 
-#include "third_party/optional.hpp"
+#include "locked_queue.h"
+#include "queue_backends.h"
 
 /*****************************************************************************/
 
@@ -47,15 +59,22 @@
  * @class ThreadSafeQueue
  * @brief Thread-safe FIFO queue supporting multiple producers and consumers.
  *
- * @tparam T Type of element stored in the queue.
+ * @tparam T     Type of element stored in the queue.
+ * @tparam Trace Tracing policy for diagnostics (see `queue_trace.h`).
+ *
+ * @details
+ * Default backend: an `std::deque` guarded by a single `std::mutex`. The locking,
+ * waiting and notification logic lives in `LockedQueue`; this class only provides
+ * the FIFO storage hooks.
  *
  * @note
  * This queue is designed for use in multi-threaded environments.
  * It provides blocking (`pop`) and non-blocking (`try_pop`) retrieval operations,
  * as well as a `close()` method for graceful termination of waiting consumers.
  */
-template <typename T>
-class ThreadSafeQueue
+template <typename T, typename Trace>
+class ThreadSafeQueue<T, MutexBackend, Trace>
+    : public LockedQueue<ThreadSafeQueue<T, MutexBackend, Trace>, T, Trace>
 {
     /******************************************************************/
 
@@ -63,11 +82,14 @@ class ThreadSafeQueue
 
    public:
     /**
-     * @brief Default constructor.
+     * @brief Constructs an empty queue, optionally limited in capacity.
+     *
+     * @param max_capacity Maximum number of elements the queue may hold at once.
+     *                     `0` (the default) means the queue is unbounded.
      *
      * Initializes an empty queue ready for use by producer and consumer threads.
      */
-    explicit ThreadSafeQueue() = default;
+    explicit ThreadSafeQueue(std::size_t max_capacity = 0);
 
     /**
      * @brief Destructor.
@@ -77,125 +99,41 @@ class ThreadSafeQueue
      */
     ~ThreadSafeQueue() = default;
 
-    /**
-     * @brief Disable copy constructor.
-     *
-     * ThreadSafeQueue cannot be copied because it manages synchronization primitives
-     * (`std::mutex`, `std::condition_variable`), which are inherently non-copyable.
-     */
-    ThreadSafeQueue(const ThreadSafeQueue&) = delete;
-
-    /**
-     * @brief Disable copy assignment operator.
-     *
-     * Copy assignment is forbidden for the same reason as the copy constructor:
-     * synchronization primitives cannot be duplicated safely.
-     */
-    ThreadSafeQueue& operator=(const ThreadSafeQueue&) = delete;
-
-    /**
-     * @brief Disable move constructor.
-     *
-     * Moving synchronization primitives would invalidate any existing waiting threads.
-     * To preserve strict ownership semantics, move operations are not supported.
-     */
-    ThreadSafeQueue(ThreadSafeQueue&&) = delete;
+    /******************************************************************/
 
-    /**
-     * @brief Disable move assignment operator.
-     *
-     * Moving the queue could break thread synchronization guarantees, so it is disabled.
-     */
-    ThreadSafeQueue& operator=(ThreadSafeQueue&&) = delete;
+    /* Private Types */
 
+   private:
     /**
-     * @brief Pushes a new element into the queue (thread-safe).
-     *
-     * @param data Rvalue reference to the element being pushed.
-     *
-     * @details
-     * Adds an element to the back of the internal buffer.
-     * If one or more threads are waiting in `pop()`, one of them will be notified.
-     *
-     * This method uses perfect forwarding via `std::move()`.
-     *
-     * @warning
-     * Throws no exceptions unless the internal `std::deque::emplace_back` does.
+     * @brief Shared locking core; befriended so it can reach the storage hooks.
      */
-    void push(T&& data);
+    using Base = LockedQueue<ThreadSafeQueue, T, Trace>;
+    friend Base;
 
-    /**
-     * @brief Pops an element from the queue, blocking until one becomes available.
-     *
-     * @param[out] data Reference to a variable where the popped value will be stored.
-     * @return `true` if an element was successfully retrieved, or `false` if the queue
-     *         was closed and empty.
-     *
-     * @details
-     * This method will block the calling thread until:
-     *  - An element is available to pop, or
-     *  - The queue has been closed via `close()`.
-     *
-     * If the queue is closed and empty, the method returns `false`.
-     */
-    bool pop(T& data);
+    /******************************************************************/
 
-    /**
-     * @brief Attempts to pop an element without blocking.
-     *
-     * @return A `nonstd::optional<T>` containing the element if available,
-     *         or `nonstd::nullopt` if the queue is empty or closed.
-     *
-     * @details
-     * This method is non-blocking and returns immediately.
-     * Useful for polling scenarios or single-threaded draining logic.
-     */
-    nonstd::optional<T> try_pop();
+    /* Private Methods */
 
+   private:
     /**
-     * @brief Checks whether the queue is currently empty.
-     *
-     * @return `true` if the queue is empty, `false` otherwise.
-     *
-     * @note
-     * This method is thread-safe and can be called concurrently with other operations.
+     * @brief Appends `data` to the back of the buffer.
      */
-    bool empty() const;
+    void enqueue_locked(T&& data);
 
     /**
-     * @brief Returns the current number of elements in the queue.
-     *
-     * @return Number of elements stored in the internal buffer.
-     *
-     * @note
-     * This method acquires a lock briefly to read the size safely.
+     * @brief Removes and returns the front element.
      */
-    size_t size() const;
+    T dequeue_locked();
 
     /**
-     * @brief Clears all elements currently stored in the queue.
-     *
-     * @details
-     * Removes all elements from the internal buffer.
-     * Does not affect the `closed` state.
-     *
-     * @warning
-     * Should be used carefully in concurrent environments to avoid discarding
-     * data being produced/consumed simultaneously.
+     * @brief Returns the number of buffered elements.
      */
-    void clear();
+    std::size_t count_locked() const;
 
     /**
-     * @brief Closes the queue, unblocking all waiting threads.
-     *
-     * @details
-     * Sets an internal flag (`closed = true`) and notifies all waiting threads
-     * so they can exit gracefully.
-     *
-     * After calling this, subsequent calls to `pop()` will return `false`
-     * once the queue is empty, and `try_pop()` will return `nullopt`.
+     * @brief Destroys every buffered element.
      */
-    void close();
+    void clear_locked();
 
     /******************************************************************/
 
@@ -207,22 +145,12 @@ class ThreadSafeQueue
      */
     std::deque<T> buffer;
 
-    /**
-     * @brief Mutex protecting access to the buffer and synchronization state.
-     */
-    mutable std::mutex mtx;
-
-    /**
-     * @brief Condition variable used to signal availability of data.
-     */
-    std::condition_variable cv;
-
-    /**
-     * @brief Indicates whether the queue has been closed (graceful shutdown flag).
-     */
-    bool closed = false;
-
     /******************************************************************/
 };
 
-#include "thread_safe_queue.ipp"
\ No newline at end of file
+#include "thread_safe_queue.ipp"
+
+#include "deadline_queue.h"
+#include "mpmc_ring_queue.h"
+#include "priority_level_queue.h"
+#include "spsc_ring_queue.h"
\ No newline at end of file
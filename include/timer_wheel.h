@@ -0,0 +1,334 @@
+/**
+ * @file        timer_wheel.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-10>
+ * @version     1.0.0
+ *
+ * @brief       Hashed timing wheel driving the delayed and periodic tasks of a WorkerPool.
+ *
+ * @details
+ * Time is cut into `TICK`-long ticks and every timer lands in slot
+ * `due_tick % SLOT_COUNT` of a circular array of buckets:
+ *  - scheduling appends to one bucket, O(1);
+ *  - cancelling flips an atomic in the timer's shared state, O(1); the entry is
+ *    dropped the next time its bucket is visited;
+ *  - one background thread visits the buckets tick by tick and hands every expired
+ *    task to a dispatch function (the pool's `submit()`), so it never runs user code.
+ *
+ * Timers further away than one revolution (`SLOT_COUNT * TICK`) simply stay in their
+ * bucket until their absolute due tick is reached. The thread sleeps until the next
+ * non-empty bucket instead of waking on every tick, and is only started by the first
+ * `schedule()` call.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @struct TimerState
+ * @brief State shared between a scheduled timer and its `TimerHandle`.
+ */
+struct TimerState
+{
+    /**
+     * @brief Lifecycle of a timer.
+     */
+    enum Status : int
+    {
+        PENDING,   /**< Waiting to fire (periodic timers stay here until cancelled). */
+        FIRED,     /**< One-shot timer handed to the pool. */
+        CANCELLED  /**< Cancelled through its handle or by `TimerWheel::stop()`. */
+    };
+
+    std::atomic<int>                    status{PENDING}; /**< One of `Status`. */
+    std::atomic<bool>                   running{false};  /**< Periodic run in progress. */
+    std::chrono::steady_clock::duration period{0};       /**< `0` for one-shot timers. */
+    Task                                task;            /**< Callable to dispatch. */
+};
+
+/**
+ * @class TimerHandle
+ * @brief Copyable reference to a scheduled timer, used to cancel it.
+ *
+ * @details
+ * A default-constructed handle refers to no timer. Dropping a handle does not
+ * cancel the timer.
+ */
+class TimerHandle
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs a handle that refers to no timer.
+     */
+    TimerHandle() = default;
+
+    /**
+     * @brief Wraps the shared state of a scheduled timer.
+     */
+    explicit TimerHandle(std::shared_ptr<TimerState> state);
+
+    /**
+     * @brief Cancels the timer.
+     *
+     * @return `true` if the timer was still pending, i.e. a one-shot task had not been
+     *         handed to the pool yet or a periodic task will not be dispatched again.
+     *
+     * @note
+     * A run already dispatched to the pool is not interrupted.
+     */
+    bool cancel();
+
+    /**
+     * @brief Returns `true` while the timer may still fire.
+     */
+    bool pending() const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Shared state of the timer (`nullptr` for an empty handle).
+     */
+    std::shared_ptr<TimerState> state;
+
+    /******************************************************************/
+};
+
+/**
+ * @class TimerWheel
+ * @brief Single-level hashed timing wheel with its own dispatch thread.
+ */
+class TimerWheel
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Resolution of the wheel; timers fire at most one tick late.
+     */
+    static constexpr std::chrono::milliseconds TICK{1};
+
+    /**
+     * @brief Number of buckets (one revolution covers `SLOT_COUNT * TICK`).
+     */
+    static constexpr std::size_t SLOT_COUNT = 4096;
+
+    /******************************************************************/
+
+    /* Public Types */
+
+   public:
+    /**
+     * @brief Receives every task that is due (normally `WorkerPool::submit()`).
+     *
+     * Returns `false` if the task was rejected (and dropped) instead of queued.
+     */
+    using Dispatch = std::function<bool(Task&&)>;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty wheel; no thread is started yet.
+     *
+     * @param dispatch Called from the wheel thread with each expired task.
+     */
+    explicit TimerWheel(Dispatch dispatch);
+
+    /**
+     * @brief Stops the wheel thread and discards pending timers.
+     */
+    ~TimerWheel();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    TimerWheel(const TimerWheel&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Schedules `task` at `when`, then every `period` if `period` is non-zero.
+     *
+     * @param when   First due time; times in the past fire on the next tick.
+     * @param period Interval between runs of a periodic timer, or `zero()`.
+     * @param task   Callable to dispatch.
+     * @return Handle that can cancel the timer.
+     *
+     * @note
+     * Thread-safe. Starts the wheel thread on first use.
+     */
+    TimerHandle schedule(std::chrono::steady_clock::time_point when,
+                         std::chrono::steady_clock::duration period, Task task);
+
+    /**
+     * @brief Stops the wheel thread and cancels every pending timer.
+     *
+     * @details
+     * Idempotent; a later `schedule()` starts the thread again.
+     */
+    void stop();
+
+    /**
+     * @brief Returns the number of stored timers (cancelled ones until they are dropped).
+     */
+    std::size_t size() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Bucket entry: absolute due tick and the timer state.
+     */
+    struct Entry
+    {
+        std::uint64_t               due;
+        std::shared_ptr<TimerState> state;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Body of the wheel thread.
+     */
+    void run();
+
+    /**
+     * @brief Converts a time point into a tick number (rounded up).
+     */
+    std::uint64_t tick_of(std::chrono::steady_clock::time_point when) const;
+
+    /**
+     * @brief Stores `entry` in its bucket.
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    void insert_locked(Entry entry);
+
+    /**
+     * @brief Returns the tick of the first non-empty bucket after `current`.
+     *
+     * @note
+     * Must be called with `mtx` held and at least one timer stored.
+     */
+    std::uint64_t next_tick_locked() const;
+
+    /**
+     * @brief Removes the timers due up to `target` and reschedules periodic ones.
+     *
+     * @param target Tick reached by the clock.
+     * @param[out] expired States whose task must be dispatched.
+     *
+     * @note
+     * Must be called with `mtx` held.
+     */
+    void expire_locked(std::uint64_t target, std::vector<std::shared_ptr<TimerState>>& expired);
+
+    /**
+     * @brief Hands one expired timer to `dispatch`.
+     */
+    void fire(const std::shared_ptr<TimerState>& state);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Destination of expired tasks.
+     */
+    Dispatch dispatch;
+
+    /**
+     * @brief Time point of tick `0`.
+     */
+    const std::chrono::steady_clock::time_point origin;
+
+    /**
+     * @brief Buckets of the wheel.
+     */
+    std::vector<std::vector<Entry>> slots;
+
+    /**
+     * @brief Last tick whose bucket has been processed.
+     */
+    std::uint64_t current;
+
+    /**
+     * @brief Number of stored entries.
+     */
+    std::size_t count;
+
+    /**
+     * @brief Tick the thread sleeps until (`UINT64_MAX` while there is no timer).
+     *
+     * @details
+     * `schedule()` only notifies the thread for timers due before it, so bursts of
+     * later timers cost no wake-up.
+     */
+    std::uint64_t wake_tick;
+
+    /**
+     * @brief Set by `stop()` to end the thread.
+     */
+    bool stopping;
+
+    /**
+     * @brief Protects every attribute above.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Wakes the thread for an earlier timer or for `stop()`.
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Wheel thread (started by the first `schedule()`).
+     */
+    std::thread worker;
+
+    /******************************************************************/
+};
@@ -0,0 +1,212 @@
+/**
+ * @file        work_stealing_deque.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-01>
+ * @version     1.0.0
+ *
+ * @brief       Chase-Lev work-stealing deque used by the WorkerPool scheduler.
+ *
+ * @details
+ * `WorkStealingDeque<T>` is owned by exactly one worker thread:
+ *  - The owner calls `push()` and `pop()` on the **bottom** end (LIFO), so the most
+ *    recently spawned task, whose data is still hot in cache, runs next.
+ *  - Any other thread calls `steal()` on the **top** end (FIFO), taking the oldest
+ *    task, which in recursive workloads is usually the largest chunk of work.
+ *
+ * Owner operations only need a CAS when racing a thief for the last element. The
+ * buffer grows geometrically; retired buffers are kept until the deque is destroyed
+ * because a thief may still be reading from them.
+ *
+ * Based on "Correct and Efficient Work-Stealing for Weak Memory Models"
+ * (Lê, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+ *
+ * @warning
+ * `push()` and `pop()` must only be called by the owning thread.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "queue_backends.h"
+
+/*****************************************************************************/
+
+/**
+ * @class WorkStealingDeque
+ * @brief Single-owner deque with lock-free stealing from the opposite end.
+ *
+ * @tparam T Element type; must be trivially copyable (typically a pointer), because
+ *           thieves read a slot before knowing whether their claim will succeed.
+ */
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WorkStealingDeque elements must be trivially copyable");
+
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Initial number of slots when none is given to the constructor.
+     */
+    static constexpr std::size_t DEFAULT_CAPACITY = 256;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty deque.
+     *
+     * @param initial_capacity Initial number of slots, rounded up to a power of two.
+     */
+    explicit WorkStealingDeque(std::size_t initial_capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Disable move constructor (thieves may hold a reference to the deque).
+     */
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    /**
+     * @brief Pushes an element on the bottom end, growing the buffer if needed (owner only).
+     *
+     * @param item Element to push.
+     */
+    void push(T item);
+
+    /**
+     * @brief Pops the most recently pushed element (owner only).
+     *
+     * @return The element, or `nonstd::nullopt` if the deque is empty.
+     */
+    nonstd::optional<T> pop();
+
+    /**
+     * @brief Steals the oldest element (any thread).
+     *
+     * @return The element, or `nonstd::nullopt` if the deque was empty or another
+     *         thread won the race for the same element.
+     */
+    nonstd::optional<T> steal();
+
+    /**
+     * @brief Returns `true` if the deque looks empty (snapshot, may be stale).
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the approximate number of stored elements.
+     */
+    std::size_t size() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @struct Buffer
+     * @brief Circular array of atomically accessed slots.
+     */
+    struct Buffer
+    {
+        explicit Buffer(std::size_t capacity);
+
+        T    get(std::int64_t index) const;
+        void put(std::int64_t index, T item);
+
+        const std::size_t                 mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Replaces `current` by a buffer twice as large holding elements `[t, b)`.
+     */
+    Buffer* grow(Buffer* current, std::int64_t t, std::int64_t b);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Steal end, advanced by thieves (and by the owner for the last element).
+     */
+    std::atomic<std::int64_t> top;
+
+    /**
+     * @brief Keeps `top` and `bottom` on different cache lines.
+     *
+     * @details
+     * Explicit padding instead of `alignas`, because deques are heap-allocated and
+     * C++14 `operator new` does not honor extended alignment.
+     */
+    char top_padding[CACHE_LINE_SIZE - sizeof(std::atomic<std::int64_t>)];
+
+    /**
+     * @brief Owner end.
+     */
+    std::atomic<std::int64_t> bottom;
+
+    /**
+     * @brief Keeps `bottom` off the cache line of the fields that follow.
+     */
+    char bottom_padding[CACHE_LINE_SIZE - sizeof(std::atomic<std::int64_t>)];
+
+    /**
+     * @brief Current circular buffer.
+     */
+    std::atomic<Buffer*> buffer;
+
+    /**
+     * @brief Every buffer ever allocated (current one included), released on destruction.
+     */
+    std::vector<std::unique_ptr<Buffer>> buffers;
+
+    /******************************************************************/
+};
+
+#include "work_stealing_deque.ipp"
@@ -0,0 +1,170 @@
+/**
+ * @file        work_stealing_deque.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-01>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the Chase-Lev work-stealing deque.
+ *
+ * @details
+ * The paper's standalone sequentially consistent fences are expressed here as
+ * sequentially consistent accesses on `bottom` / `top`, and the publication of a
+ * pushed element as a release store on `bottom`. The resulting code is equivalent on
+ * x86 and ARM, and ThreadSanitizer (which does not model fences) can follow it.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "work_stealing_deque.h"
+
+/*****************************************************************************/
+
+/* Static member definitions */
+
+template <typename T>
+constexpr std::size_t WorkStealingDeque<T>::DEFAULT_CAPACITY;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Allocates the initial buffer.
+ */
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(std::size_t initial_capacity)
+    : top(0), bottom(0), buffer(nullptr) {
+    std::size_t capacity = 2;
+    while (capacity < initial_capacity) capacity <<= 1;
+
+    buffers.emplace_back(new Buffer(capacity));
+    buffer.store(buffers.back().get(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Pushes `item` on the bottom end.
+ *
+ * @details
+ * GIVEN the owning worker spawning a child task,
+ * WHEN `push()` is called,
+ * THEN the item is written to slot `bottom` and published with a release store, so
+ * a thief that observes the new `bottom` also observes the item.
+ */
+template <typename T>
+void WorkStealingDeque<T>::push(T item) {
+    const std::int64_t b   = bottom.load(std::memory_order_relaxed);
+    const std::int64_t t   = top.load(std::memory_order_acquire);
+    Buffer*            buf = buffer.load(std::memory_order_relaxed);
+
+    if (b - t > static_cast<std::int64_t>(buf->mask)) buf = grow(buf, t, b);
+
+    buf->put(b, item);
+    bottom.store(b + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Pops the most recently pushed element.
+ *
+ * @details
+ * The owner first reserves slot `bottom - 1`, then reads `top`. If more than one
+ * element remains no thief can reach the reserved slot; for the last element the
+ * owner races thieves with a CAS on `top`.
+ */
+template <typename T>
+nonstd::optional<T> WorkStealingDeque<T>::pop() {
+    const std::int64_t b   = bottom.load(std::memory_order_relaxed) - 1;
+    Buffer*            buf = buffer.load(std::memory_order_relaxed);
+    bottom.store(b);
+    std::int64_t t = top.load();
+
+    if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nonstd::nullopt;
+    }
+
+    T item = buf->get(b);
+    if (t == b) {
+        const bool won = top.compare_exchange_strong(t, t + 1);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        if (!won) return nonstd::nullopt;
+    }
+    return item;
+}
+
+/**
+ * @brief Steals the oldest element.
+ *
+ * @details
+ * The thief reads the slot at `top` before claiming it with a CAS; if the CAS fails
+ * another thread took that element and the read value is discarded.
+ */
+template <typename T>
+nonstd::optional<T> WorkStealingDeque<T>::steal() {
+    std::int64_t       t = top.load();
+    const std::int64_t b = bottom.load();
+
+    if (t >= b) return nonstd::nullopt;
+
+    Buffer* buf  = buffer.load(std::memory_order_acquire);
+    T       item = buf->get(t);
+    if (!top.compare_exchange_strong(t, t + 1)) return nonstd::nullopt;
+    return item;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+std::size_t WorkStealingDeque<T>::size() const {
+    const std::int64_t b = bottom.load(std::memory_order_relaxed);
+    const std::int64_t t = top.load(std::memory_order_relaxed);
+    return b > t ? static_cast<std::size_t>(b - t) : 0;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Doubles the buffer, copying the live range `[t, b)`.
+ *
+ * @details
+ * The old buffer stays allocated (in `buffers`) because a concurrent thief may have
+ * loaded it just before the swap.
+ */
+template <typename T>
+typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::grow(Buffer* current,
+                                                                  std::int64_t t,
+                                                                  std::int64_t b) {
+    buffers.emplace_back(new Buffer((current->mask + 1) * 2));
+    Buffer* next = buffers.back().get();
+
+    for (std::int64_t i = t; i < b; ++i) next->put(i, current->get(i));
+
+    buffer.store(next, std::memory_order_release);
+    return next;
+}
+
+/*****************************************************************************/
+
+/* Buffer */
+
+template <typename T>
+WorkStealingDeque<T>::Buffer::Buffer(std::size_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+template <typename T>
+T WorkStealingDeque<T>::Buffer::get(std::int64_t index) const {
+    return slots[static_cast<std::size_t>(index) & mask].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::Buffer::put(std::int64_t index, T item) {
+    slots[static_cast<std::size_t>(index) & mask].store(item, std::memory_order_relaxed);
+}
+
+/*****************************************************************************/
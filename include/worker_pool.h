@@ -9,19 +9,44 @@
  *
  * @details
  * The WorkerPool class coordinates a fixed number of worker threads that
- * continuously consume tasks from a `ThreadSafeQueue<std::function<void()>>`.
+ * continuously consume tasks from a `ThreadSafeQueue<Task>`.
  *
  * The design follows a **producer-consumer model**:
  * - The main thread (producer) submits tasks via `submit()`.
  * - Worker threads (consumers) run the `run()` loop, each retrieving and executing tasks.
  *
  * The pool supports **graceful shutdown** via `stop()`, which waits for pending tasks to finish
- * before joining all worker threads.
+ * before joining all worker threads. `wait_idle()` exposes the same completion barrier
+ * without stopping the pool.
  *
  * Key properties:
  * - Thread-safe task submission.
  * - Deterministic start/stop lifecycle.
  * - Automatic synchronization through `ThreadSafeQueue`.
+ * - Works with any `ThreadSafeQueue` backend (`MutexBackend`, `MpmcRingBackend`, ...).
+ * - Tasks are move-only `Task` objects: typical lambdas are stored inline, so
+ *   submitting a `Task` performs no heap allocation.
+ * - `submit(f, args...)` returns a `TaskFuture` with the result of `f(args...)`; the
+ *   callable and the future's shared state share a single allocation.
+ * - Optional **work-stealing** scheduling (`SchedulingMode::WorkStealing`): each worker
+ *   owns a Chase-Lev deque, tasks spawned by a worker stay local (LIFO) and idle
+ *   workers steal (FIFO) from random victims. The external queue becomes the shared
+ *   injection queue for submissions from non-worker threads.
+ * - Optional **elastic** sizing (`start_elastic()`): workers are spawned between a
+ *   minimum and a maximum when the backlog grows or tasks wait too long, and retired
+ *   after an idle timeout.
+ * - Optional CPU pinning (`set_affinity()`): compact, scatter, explicit CPU list or
+ *   process cpuset, with the resulting mapping available from `affinity_map()`.
+ * - Optional instrumentation (`set_instrumentation()`): queue wait and run time of
+ *   every submitted task go into per-worker histograms, merged by `stats()`.
+ * - Delayed and periodic tasks (`schedule_after()`, `schedule_at()`,
+ *   `schedule_every()`): a single timing wheel thread per pool submits them when due.
+ * - Cooperative cancellation (`submit(task, token)`): tasks whose `CancellationToken`
+ *   is cancelled are dropped at dequeue without running, and counted in `stats()`.
+ * - Per-task deadlines (`submit(task, deadline)`): a task dequeued after its deadline
+ *   is shed without running, handed to the optional expiry callback and counted in
+ *   `stats()`. `ThreadSafeQueue<Task, DeadlineBackend>` serves the earliest deadline
+ *   first.
  */
 
 /*****************************************************************************/
@@ -35,15 +60,28 @@
 /* Standard libraries */
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 /* Project libraries */
 
+#include "cpu_affinity.h"
+#include "latency_histogram.h"
+#include "task.h"
+#include "task_future.h"
 #include "thread_safe_queue.h"
+#include "timer_wheel.h"
+#include "work_stealing_deque.h"
 
 /*****************************************************************************/
 
@@ -64,6 +102,9 @@
  * WorkerPool does **not** own the queue — it receives a reference to an external
  * `ThreadSafeQueue` instance during construction. This allows flexible sharing or
  * reuse between multiple components.
+ *
+ * The queue backend is erased behind a small internal interface (`TaskQueueHandle`),
+ * so the same non-template pool can drive a mutex-based or a lock-free queue.
  */
 class WorkerPool
 {
@@ -77,6 +118,66 @@ class WorkerPool
      */
     static constexpr const char* DEFAULT_WORKER_NAME = "Worker ";
 
+    /**
+     * @brief Upper bound on how long an idle work-stealing worker sleeps before rescanning.
+     *
+     * @details
+     * Wake-ups are normally explicit; this only bounds the delay for tasks pushed
+     * straight into the external queue without going through `submit()`.
+     */
+    static constexpr std::chrono::milliseconds PARK_TIMEOUT{10};
+
+    /******************************************************************/
+
+    /* Public Types */
+
+   public:
+    /**
+     * @enum SchedulingMode
+     * @brief How workers obtain tasks.
+     */
+    enum class SchedulingMode
+    {
+        SharedQueue,  /**< Every worker pops from the shared queue (default). */
+        WorkStealing  /**< Per-worker Chase-Lev deques plus the shared injection queue. */
+    };
+
+    /**
+     * @brief Called on the worker thread with each task shed past its deadline.
+     */
+    using ExpiryCallback = std::function<void(Task&&)>;
+
+    /**
+     * @struct ElasticConfig
+     * @brief Sizing policy for `start_elastic()`.
+     *
+     * @details
+     * A new worker is spawned when no worker is idle and either more than
+     * `spawn_backlog` tasks are waiting, or tasks have been waiting without an idle
+     * worker for longer than `spawn_wait`. A worker that finds no work for
+     * `idle_timeout` retires, as long as more than `min_workers` remain.
+     */
+    struct ElasticConfig
+    {
+        int                       min_workers   = 1;     /**< Workers kept alive when idle. */
+        int                       max_workers   = 8;     /**< Hard upper bound. */
+        std::size_t               spawn_backlog = 4;     /**< Queued tasks that trigger a spawn. */
+        std::chrono::milliseconds spawn_wait{5};         /**< Backlog age that triggers a spawn. */
+        std::chrono::milliseconds idle_timeout{10000};   /**< Idle time before retiring. */
+    };
+
+    /**
+     * @struct Stats
+     * @brief Latency and shedding snapshot returned by `stats()`.
+     */
+    struct Stats
+    {
+        LatencySummary queue_wait;    /**< From `submit()` until a worker starts the task. */
+        LatencySummary run_time;      /**< Execution time of the task itself. */
+        std::uint64_t  cancelled = 0; /**< Tasks dropped because their token was cancelled. */
+        std::uint64_t  expired   = 0; /**< Tasks shed because their deadline had passed. */
+    };
+
     /******************************************************************/
 
     /* Public Methods */
@@ -85,17 +186,26 @@ class WorkerPool
     /**
      * @brief Constructs a WorkerPool attached to an existing ThreadSafeQueue.
      *
+     * @tparam Backend Storage backend of the queue (deduced).
+     * @tparam Trace   Tracing policy of the queue (deduced).
      * @param queue Reference to the queue from which worker threads will consume tasks.
+     * @param mode  Scheduling strategy (`SchedulingMode::SharedQueue` by default).
      *
      * @details
-     * GIVEN an external `ThreadSafeQueue<std::function<void()>>`,
+     * GIVEN an external `ThreadSafeQueue<Task, Backend, Trace>`,
      * WHEN the WorkerPool is constructed,
      * THEN it binds to that queue but does not start any threads yet.
      *
      * @note
-     * Threads are only created when `start()` is explicitly called.
+     * - Threads are only created when `start()` is explicitly called.
+     * - In `SchedulingMode::WorkStealing` the queue is the injection queue; tasks must
+     *   be submitted through `submit()` so idle workers are woken promptly.
+     * - `SpscRingBackend` is rejected at compile time: the queue is shared by several
+     *   submitters (callers, workers, the timer thread) and several workers.
      */
-    explicit WorkerPool(ThreadSafeQueue<std::function<void()>>& queue);
+    template <typename Backend, typename Trace>
+    explicit WorkerPool(ThreadSafeQueue<Task, Backend, Trace>& queue,
+                        SchedulingMode                         mode = SchedulingMode::SharedQueue);
 
     /**
      * @brief Destructor.
@@ -161,10 +271,124 @@ class WorkerPool
      */
     void start(const int number_workers);
 
+    /**
+     * @brief Starts the pool in elastic mode.
+     *
+     * @param config Minimum/maximum worker counts, spawn thresholds and idle timeout.
+     *
+     * @details
+     * GIVEN an idle WorkerPool in `SchedulingMode::SharedQueue`,
+     * WHEN `start_elastic(config)` is called,
+     * THEN `config.min_workers` threads are started, and the pool then grows up to
+     * `config.max_workers` under backlog and shrinks back when workers stay idle.
+     *
+     * @note
+     * - Growth is evaluated in `submit()` and whenever a worker picks up a task.
+     * - Idle elastic workers wait in the queue's `pop_for()`, so any push wakes them,
+     *   whether it comes from `submit()` or straight from a producer.
+     * - Work-stealing pools keep one deque per worker and cannot resize; in that mode
+     *   `config.max_workers` fixed workers are started instead.
+     */
+    void start_elastic(const ElasticConfig& config);
+
+    /**
+     * @brief Returns the number of live worker threads.
+     */
+    std::size_t worker_count() const;
+
+    /**
+     * @brief Selects how worker threads are pinned to CPUs.
+     *
+     * @param policy Pinning policy (see `AffinityPolicy`).
+     *
+     * @details
+     * GIVEN a WorkerPool,
+     * WHEN `set_affinity(policy)` is called before `start()` / `start_elastic()`,
+     * THEN every worker spawned afterwards is pinned with `pthread_setaffinity_np`
+     * to slot `id % slots` of `CpuAffinity::plan(policy)`.
+     *
+     * @note
+     * - Workers that are already running keep their current affinity.
+     * - A worker runs unpinned for the few microseconds between its creation and
+     *   the `pthread_setaffinity_np` call.
+     * - If pinning fails (or on non-Linux platforms) a warning is logged and the
+     *   worker runs unpinned.
+     */
+    void set_affinity(const AffinityPolicy& policy);
+
+    /**
+     * @brief Installs the callback that receives tasks shed past their deadline.
+     *
+     * @param callback Callable invoked once per shed task, or an empty function.
+     *
+     * @details
+     * GIVEN a pool whose callback reports timeouts to clients,
+     * WHEN a worker dequeues a task whose deadline has passed,
+     * THEN the task body is not run; `callback` receives the task instead (it may run a
+     * cheaper fallback or simply release it) on that worker's thread.
+     *
+     * @note
+     * - Must be called before `start()` / `start_elastic()`.
+     * - Exceptions thrown by the callback are caught and logged.
+     */
+    void set_expiry_callback(ExpiryCallback callback);
+
+    /**
+     * @brief Applies the dequeue-time checks of the workers to `task`.
+     *
+     * @return `true` if `task` must not run: its token is cancelled or its deadline
+     *         has passed. It has then been counted in `stats()`, handed to the expiry
+     *         callback if it expired, and released.
+     *
+     * @details
+     * Workers call it on every task they dequeue; executors that keep their own queue
+     * on top of the pool (e.g. `Strand`) call it on each task they are about to run,
+     * so cancellation and deadlines hold for their tasks too.
+     */
+    bool discard_if_stale(Task& task);
+
+    /**
+     * @brief Returns the CPUs each live worker is pinned to.
+     *
+     * @return Worker name → CPU ids; unpinned workers are absent.
+     */
+    std::unordered_map<std::string, std::vector<int>> affinity_map() const;
+
+    /**
+     * @brief Enables or disables per-task latency instrumentation.
+     *
+     * @param enabled `true` to start timestamping submitted tasks.
+     *
+     * @details
+     * GIVEN an instrumented pool,
+     * WHEN a task goes through `submit()` and a worker runs it,
+     * THEN its queue wait (submit → start) and run time (start → end) are recorded in
+     * the executing worker's histograms without taking any lock.
+     *
+     * @note
+     * - Disabled by default; the disabled cost is one relaxed load in `submit()` and
+     *   one branch per executed task.
+     * - Tasks pushed straight into the queue carry no timestamp and are not recorded.
+     */
+    void set_instrumentation(bool enabled);
+
+    /**
+     * @brief Merges every worker's histograms into a latency snapshot.
+     *
+     * @return p50 / p99 / p99.9 / max of queue wait and run time for all tasks
+     *         recorded since the pool was constructed.
+     */
+    Stats stats() const;
+
     /**
      * @brief Submits a task to be executed by any available worker.
      *
-     * @param task Callable object representing a task (e.g., lambda or `std::bind`).
+     * @param task     Callable object representing a task (e.g., lambda or `std::bind`),
+     *                 implicitly wrapped in a move-only `Task`.
+     * @param priority Level the task is queued at; only a `PriorityBackend` queue
+     *                 orders by it, other backends stay FIFO.
+     * @return `true` if the task was accepted, `false` if it was dropped (queue closed,
+     *         or token already cancelled).
      *
      * @details
      * GIVEN a running pool with one or more active workers,
@@ -174,10 +398,121 @@ class WorkerPool
      *
      * @note
      * - Thread-safe.
-     * - If the queue is closed, submitting new tasks may have no effect.
+     * - If the queue is closed (the pool is stopping), the task is dropped and
+     *   `false` is returned; callers that track completion must account for it.
      * - Uses perfect forwarding and `std::move()` for efficiency.
+     * - Move-only captures (e.g. `std::unique_ptr`) are supported.
+     * - In work-stealing mode, a task submitted from inside a worker is pushed onto
+     *   that worker's own deque instead of the shared queue, and `priority` is
+     *   ignored.
+     */
+    bool submit(Task task, Priority priority = Priority::Normal);
+
+    /**
+     * @brief Submits `f(args...)` and returns a future for its result.
+     *
+     * @tparam F    Callable type.
+     * @tparam Args Argument types (decay-copied or moved into the task).
+     * @param f    Callable to run on a worker.
+     * @param args Arguments bound to the call.
+     * @return A `TaskFuture` holding the return value or the exception thrown by `f`.
+     *
+     * @details
+     * GIVEN a running pool,
+     * WHEN `submit(f, args...)` is called,
+     * THEN the callable, its arguments and the future's shared state are placed in a
+     * single heap block, a pointer-sized `Task` referencing it is queued, and the
+     * returned future becomes ready once a worker has run it.
+     *
+     * @note
+     * - If the queue is closed, the task is dropped and `get()` throws
+     *   `std::future_error` with `std::future_errc::broken_promise`.
+     * - Passing an existing `Task` selects the fire-and-forget overload instead.
+     */
+    template <typename F, typename... Args,
+              typename = typename std::enable_if<
+                  !std::is_same<typename std::decay<F>::type, Task>::value &&
+                  !std::is_same<typename std::decay<F>::type, Priority>::value &&
+                  !std::is_same<typename std::decay<F>::type, CancellationToken>::value &&
+                  !std::is_same<typename std::decay<F>::type,
+                                std::chrono::steady_clock::time_point>::value>::type>
+    TaskFuture<TaskResultOf<F, Args...>> submit(F&& f, Args&&... args);
+
+    /**
+     * @brief Submits `f(args...)` at the given priority and returns a future for it.
+     *
+     * @param priority Level the task is queued at (see `submit(Task, Priority)`).
+     *
+     * @details
+     * GIVEN a pool built on a `ThreadSafeQueue<Task, PriorityBackend>`,
+     * WHEN `submit(Priority::High, f)` is called while `Low` tasks are queued,
+     * THEN `f` runs as soon as a worker is free, ahead of the queued `Low` tasks.
+     */
+    template <typename F, typename... Args>
+    TaskFuture<TaskResultOf<F, Args...>> submit(Priority priority, F&& f, Args&&... args);
+
+    /**
+     * @brief Submits a task that is skipped if `token` is cancelled before it starts.
+     *
+     * @param task     Task to run.
+     * @param token    Token checked when a worker dequeues the task.
+     * @param priority Level the task is queued at (see `submit(Task, Priority)`).
+     *
+     * @details
+     * GIVEN thousands of queued tasks sharing the token of a disconnected client,
+     * WHEN the source is cancelled,
+     * THEN every one of them that has not started is dropped by the worker that
+     * dequeues it: its body never runs, its captures are released, `wait_idle()` still
+     * accounts for it and `stats().cancelled` counts it. A task submitted with an
+     * already cancelled token is not queued at all.
+     *
+     * @note
+     * Running tasks are not interrupted; they can poll the token themselves.
+     */
+    bool submit(Task task, CancellationToken token, Priority priority = Priority::Normal);
+
+    /**
+     * @brief Submits `f(args...)` with a cancellation token and returns its future.
+     *
+     * @details
+     * If the task is dropped because of `token`, `get()` throws `std::future_error`
+     * with `std::future_errc::broken_promise`.
+     */
+    template <typename F, typename... Args>
+    TaskFuture<TaskResultOf<F, Args...>> submit(const CancellationToken& token, F&& f,
+                                                Args&&... args);
+
+    /**
+     * @brief Submits a task that is shed if no worker starts it before `deadline`.
+     *
+     * @param task     Task to run.
+     * @param deadline Latest point in time at which starting the task is still useful.
+     * @param priority Level the task is queued at (see `submit(Task, Priority)`).
+     *
+     * @details
+     * GIVEN a burst that leaves tasks queued longer than their clients will wait,
+     * WHEN a worker dequeues a task after its deadline,
+     * THEN the task body is skipped, the expiry callback (if any) receives the task,
+     * `stats().expired` counts it and `wait_idle()` still accounts for it; the worker
+     * moves on to work that can still be useful.
+     *
+     * @note
+     * - Only the start is bounded: a task that starts in time runs to completion.
+     * - Pair with a `DeadlineBackend` queue to serve the earliest deadline first.
+     */
+    bool submit(Task task, std::chrono::steady_clock::time_point deadline,
+                Priority priority = Priority::Normal);
+
+    /**
+     * @brief Submits `f(args...)` with a deadline and returns its future.
+     *
+     * @details
+     * If the task is shed, `get()` throws `std::future_error` with
+     * `std::future_errc::broken_promise`.
      */
-    void submit(std::function<void()> task);
+    template <typename F, typename... Args>
+    TaskFuture<TaskResultOf<F, Args...>> submit(std::chrono::steady_clock::time_point deadline,
+                                                F&& f, Args&&... args);
 
     /**
      * @brief Stops all workers and waits for remaining tasks to complete.
@@ -199,6 +534,72 @@ class WorkerPool
      */
     void stop();
 
+    /**
+     * @brief Blocks until every submitted task has finished executing.
+     *
+     * @details
+     * GIVEN a running pool with queued or executing tasks,
+     * WHEN `wait_idle()` is called,
+     * THEN it returns once the in-flight counter (incremented by `submit()`, decremented
+     * after each task runs or is rejected) drops to zero.
+     *
+     * @note
+     * - Tasks pushed straight into the queue, bypassing `submit()`, are not tracked.
+     * - Must not be called from inside a task (it would wait for itself).
+     */
+    void wait_idle();
+
+    /**
+     * @brief Like `wait_idle()`, but gives up after `timeout`.
+     *
+     * @param timeout Maximum time to wait.
+     * @return `true` if the pool became idle, `false` on timeout.
+     */
+    template <typename Rep, typename Period>
+    bool wait_idle_for(const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Submits `task` once `delay` has elapsed.
+     *
+     * @param delay Time to wait before the task is submitted.
+     * @param task  Task to run.
+     * @return Handle that can cancel the task until it is submitted.
+     *
+     * @details
+     * GIVEN a running pool,
+     * WHEN `schedule_after(std::chrono::milliseconds(50), task)` is called,
+     * THEN the pool's timing wheel submits `task` about 50 ms later (at most one
+     * `TimerWheel::TICK` late), without any extra thread per timer.
+     *
+     * @note
+     * - Scheduled tasks count as in flight only once submitted, so `wait_idle()` does
+     *   not wait for timers that have not fired yet.
+     * - `stop()` cancels every pending timer.
+     */
+    template <typename Rep, typename Period>
+    TimerHandle schedule_after(const std::chrono::duration<Rep, Period>& delay, Task task);
+
+    /**
+     * @brief Submits `task` at `when` (immediately if `when` is in the past).
+     *
+     * @return Handle that can cancel the task until it is submitted.
+     */
+    TimerHandle schedule_at(std::chrono::steady_clock::time_point when, Task task);
+
+    /**
+     * @brief Submits `task` every `period`, starting one period from now.
+     *
+     * @param period Interval between runs.
+     * @param task   Task run on every period; it is invoked in place, not moved.
+     * @return Handle that stops further runs when cancelled.
+     *
+     * @details
+     * Runs follow a fixed rate. Runs of the same timer never overlap: a period that
+     * elapses while the previous run is still executing is skipped.
+     */
+    template <typename Rep, typename Period>
+    TimerHandle schedule_every(const std::chrono::duration<Rep, Period>& period, Task task);
+
     /******************************************************************/
 
     /* Private Methods */
@@ -221,19 +622,199 @@ class WorkerPool
      */
     void run(const std::string& worker_name);
 
+    /**
+     * @brief Worker loop used in `SchedulingMode::WorkStealing`.
+     *
+     * @param worker_name Unique name identifying the thread.
+     * @param index       Index of the worker's own deque in `deques`.
+     *
+     * @details
+     * Looks for work in order: own deque (LIFO), injection queue, random victims
+     * (FIFO steal). When nothing is found the worker parks until new work is
+     * submitted, and exits once the pool is stopping and no work is left.
+     */
+    void run_stealing(const std::string& worker_name, std::size_t index);
+
+    /**
+     * @brief Worker loop used in elastic mode.
+     *
+     * @param worker_name Unique name identifying the thread.
+     *
+     * @details
+     * Waits in the queue with `pop_for(idle_timeout)`, retires when that times out,
+     * and exits once the queue reports `PopStatus::Closed` (stopped and drained).
+     */
+    void run_elastic(const std::string& worker_name);
+
+    /**
+     * @brief Creates one worker thread running the loop that matches the pool mode.
+     *
+     * @note `workers_mtx` must be held.
+     */
+    void spawn_worker_locked();
+
+    /**
+     * @brief Spawns a worker if the elastic growth conditions hold.
+     */
+    void maybe_grow();
+
+    /**
+     * @brief Retires the calling elastic worker if more than `min_workers` remain.
+     *
+     * @return `true` if the worker must exit.
+     */
+    bool try_retire(const std::string& worker_name);
+
+    /**
+     * @brief Obtains the next task for worker `index` without blocking.
+     *
+     * @param index     Index of the calling worker.
+     * @param seed      Per-worker xorshift state used to pick steal victims.
+     * @param[out] task Receives the task.
+     * @return `true` if a task was found.
+     */
+    bool find_task(std::size_t index, std::uint32_t& seed, Task& task);
+
+    /**
+     * @brief Returns `true` if any deque or the injection queue looks non-empty.
+     */
+    bool has_work() const;
+
+    /**
+     * @brief Parks an idle work-stealing worker.
+     *
+     * @param timeout Maximum time to sleep before rescanning.
+     * @return `false` if the worker should exit (pool stopping and no work left).
+     */
+    bool park(std::chrono::steady_clock::duration timeout);
+
+    /**
+     * @brief Wakes one parked work-stealing worker, if any.
+     */
+    void wake_one();
+
+    /**
+     * @brief Runs `task`, logging any exception it throws, then marks it finished.
+     */
+    void execute(Task& task, const std::string& worker_name);
+
+    /**
+     * @brief Decrements `in_flight` and wakes idle waiters when it reaches zero.
+     */
+    void task_finished();
+
+    struct WorkerHistograms;
+
+    /**
+     * @brief Hands a histogram pair to a new worker, reusing one of an exited worker.
+     */
+    WorkerHistograms* acquire_histograms();
+
+    /**
+     * @brief Returns a worker's histogram pair to the free list when it exits.
+     */
+    void release_histograms(WorkerHistograms* slot);
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @struct WorkerHistograms
+     * @brief Latency histograms written only by the worker that owns them.
+     */
+    struct WorkerHistograms
+    {
+        LatencyHistogram queue_wait; /**< Submit → start. */
+        LatencyHistogram run_time;   /**< Start → end. */
+    };
+
+    /**
+     * @class TaskQueueHandle
+     * @brief Backend-agnostic view of the task queue used by the pool.
+     *
+     * @details
+     * Exposes only the operations the pool needs, so `WorkerPool` itself stays a
+     * non-template class compiled once in `worker_pool.cpp`.
+     */
+    class TaskQueueHandle
+    {
+       public:
+        virtual ~TaskQueueHandle() = default;
+
+        virtual bool      push(Task&& task, Priority priority)                             = 0;
+        virtual bool      pop(Task& task)                                                  = 0;
+        virtual bool      try_pop(Task& task)                                              = 0;
+        virtual PopStatus pop_for(Task& task, std::chrono::steady_clock::duration timeout) = 0;
+        virtual bool      empty() const                                                    = 0;
+        virtual void      close()                                                          = 0;
+    };
+
+    /**
+     * @class TaskQueueAdapter
+     * @brief Forwards `TaskQueueHandle` calls to a concrete `ThreadSafeQueue`.
+     *
+     * @tparam Queue Concrete queue type.
+     */
+    template <typename Queue>
+    class TaskQueueAdapter final : public TaskQueueHandle
+    {
+       public:
+        explicit TaskQueueAdapter(Queue& queue) : queue(queue) {}
+
+        bool push(Task&& task, Priority priority) override
+        {
+            return push_to(queue, std::move(task), priority);
+        }
+        bool pop(Task& task) override { return queue.pop(task); }
+        bool try_pop(Task& task) override
+        {
+            nonstd::optional<Task> item = queue.try_pop();
+            if (!item) return false;
+            task = std::move(*item);
+            return true;
+        }
+        PopStatus pop_for(Task& task, std::chrono::steady_clock::duration timeout) override
+        {
+            return queue.pop_for(task, timeout);
+        }
+        bool empty() const override { return queue.empty(); }
+        void close() override { queue.close(); }
+
+       private:
+        /**
+         * @brief Backends without priority levels ignore `priority`.
+         */
+        template <typename AnyQueue>
+        static bool push_to(AnyQueue& target, Task&& task, Priority)
+        {
+            return target.push(std::move(task));
+        }
+
+        template <typename Trace>
+        static bool push_to(ThreadSafeQueue<Task, PriorityBackend, Trace>& target, Task&& task,
+                            Priority priority)
+        {
+            return target.push(std::move(task), priority);
+        }
+
+        Queue& queue;
+    };
+
     /******************************************************************/
 
     /* Private Attributes */
 
    private:
     /**
-     * @brief Reference to the task queue shared among workers.
+     * @brief Handle to the task queue shared among workers.
      *
      * @details
      * The queue must outlive the WorkerPool instance.
      * The pool never owns or destroys the queue; it only accesses it.
      */
-    ThreadSafeQueue<std::function<void()>>& task_queue;
+    std::unique_ptr<TaskQueueHandle> task_queue;
 
     /**
      * @brief Atomic flag controlling the running state of all workers.
@@ -249,8 +830,165 @@ class WorkerPool
      * @details
      * Stores active workers as (`name`, `std::thread`) pairs.
      * Threads are joined and cleared during shutdown.
+     * Guarded by `workers_mtx`, since elastic workers are added and removed while the
+     * pool runs.
      */
     std::unordered_map<std::string, std::thread> workers;
 
+    /**
+     * @brief Protects `workers`, `retired`, `next_worker_id`, `affinity_slots` and
+     *        `worker_cpus`.
+     */
+    mutable std::mutex workers_mtx;
+
+    /**
+     * @brief Threads of retired elastic workers, joined on the next spawn or on `stop()`.
+     *
+     * @details
+     * A retiring worker cannot join itself, so it moves its own `std::thread` here
+     * before returning from its loop.
+     */
+    std::vector<std::thread> retired;
+
+    /**
+     * @brief Suffix for the next worker name.
+     */
+    int next_worker_id;
+
+    /**
+     * @brief CPU slots computed by `set_affinity()` (empty when unpinned).
+     */
+    std::vector<std::vector<int>> affinity_slots;
+
+    /**
+     * @brief CPUs each live worker was pinned to.
+     */
+    std::unordered_map<std::string, std::vector<int>> worker_cpus;
+
+    /**
+     * @brief `true` while the pool runs in elastic mode.
+     */
+    std::atomic<bool> elastic;
+
+    /**
+     * @brief Sizing policy of the current elastic run.
+     */
+    ElasticConfig elastic_config;
+
+    /**
+     * @brief Number of live worker threads.
+     */
+    std::atomic<int> live_workers;
+
+    /**
+     * @brief Number of elastic workers currently without a task.
+     */
+    std::atomic<int> idle_workers;
+
+    /**
+     * @brief Steady-clock time (ns) since tasks have been waiting with no idle worker;
+     *        `0` when there is no such backlog.
+     */
+    std::atomic<std::int64_t> backlog_since;
+
+    /**
+     * @brief Scheduling strategy chosen at construction.
+     */
+    const SchedulingMode mode;
+
+    /**
+     * @brief Per-worker deques (work-stealing mode only), indexed like the workers.
+     *
+     * @details
+     * Hold heap-allocated tasks because thieves may read a slot before their claim is
+     * confirmed, which requires trivially copyable elements.
+     */
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> deques;
+
+    /**
+     * @brief Set by `stop()` once the injection queue is closed (work-stealing mode).
+     */
+    std::atomic<bool> stopping;
+
+    /**
+     * @brief Number of work-stealing workers currently parked.
+     */
+    std::atomic<int> sleepers;
+
+    /**
+     * @brief Mutex protecting the parking protocol.
+     */
+    std::mutex park_mtx;
+
+    /**
+     * @brief Condition variable idle work-stealing workers park on.
+     */
+    std::condition_variable park_cv;
+
+    /**
+     * @brief Tasks submitted but not yet finished (queued, in a deque, or running).
+     */
+    std::atomic<std::size_t> in_flight;
+
+    /**
+     * @brief Mutex paired with `idle_cv`.
+     */
+    std::mutex idle_mtx;
+
+    /**
+     * @brief Signalled when `in_flight` drops to zero.
+     */
+    std::condition_variable idle_cv;
+
+    /**
+     * @brief `true` while `submit()` timestamps tasks for the statistics.
+     */
+    std::atomic<bool> instrumented;
+
+    /**
+     * @brief Tasks dropped because their cancellation token was cancelled.
+     */
+    std::atomic<std::uint64_t> cancelled_tasks;
+
+    /**
+     * @brief Tasks shed because they were dequeued after their deadline.
+     */
+    std::atomic<std::uint64_t> expired_tasks;
+
+    /**
+     * @brief Receives shed tasks; set before the workers start.
+     */
+    ExpiryCallback on_expired;
+
+    /**
+     * @brief Protects `histograms` and `free_histograms`.
+     */
+    mutable std::mutex stats_mtx;
+
+    /**
+     * @brief Every histogram pair ever handed to a worker (kept for `stats()`).
+     */
+    std::vector<std::unique_ptr<WorkerHistograms>> histograms;
+
+    /**
+     * @brief Histogram pairs of exited workers, reused by the next spawned worker.
+     */
+    std::vector<WorkerHistograms*> free_histograms;
+
+    /**
+     * @brief Histograms of the worker running on the current thread (`nullptr` elsewhere).
+     */
+    static thread_local WorkerHistograms* current_histograms;
+
+    /**
+     * @brief Timing wheel of `schedule_*()`; its thread calls `submit()` when timers expire.
+     *
+     * @details
+     * Declared last so that it is destroyed (and its thread joined) first.
+     */
+    TimerWheel timers;
+
     /******************************************************************/
-};
\ No newline at end of file
+};
+
+#include "worker_pool.ipp"
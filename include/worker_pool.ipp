@@ -0,0 +1,155 @@
+/**
+ * @file        worker_pool.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-10-20>
+ * @version     1.0.0
+ *
+ * @brief       Template members of the WorkerPool class.
+ *
+ * @details
+ * Only the backend-deducing constructor, the future-returning `submit()` overloads,
+ * the duration-based `schedule_*()` and the timed `wait_idle_for()` live here; the
+ * rest of the pool is implemented in `worker_pool.cpp`.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+
+/* Project libraries */
+
+#include "worker_pool.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Constructs a WorkerPool attached to a shared ThreadSafeQueue.
+ *
+ * @tparam Backend Storage backend of the queue (deduced).
+ * @tparam Trace   Tracing policy of the queue (deduced).
+ * @param queue Reference to the task queue shared among all workers.
+ * @param mode  Scheduling strategy.
+ *
+ * @details
+ * GIVEN an existing queue instance of any backend,
+ * WHEN the WorkerPool is constructed,
+ * THEN it wraps the queue in a `TaskQueueAdapter` and initializes its internal
+ * state, but does not spawn any threads yet.
+ *
+ * The actual worker threads are created only after calling `start()`.
+ * A single-producer/single-consumer queue cannot back a pool, which has several of
+ * both, so `SpscRingBackend` fails to compile here.
+ */
+template <typename Backend, typename Trace>
+WorkerPool::WorkerPool(ThreadSafeQueue<Task, Backend, Trace>& queue, SchedulingMode mode)
+    : task_queue(new TaskQueueAdapter<ThreadSafeQueue<Task, Backend, Trace>>(queue)),
+      running(false),
+      next_worker_id(0),
+      elastic(false),
+      live_workers(0),
+      idle_workers(0),
+      backlog_since(0),
+      mode(mode),
+      stopping(false),
+      sleepers(0),
+      in_flight(0),
+      instrumented(false),
+      cancelled_tasks(0),
+      expired_tasks(0),
+      timers([this](Task&& task) { return submit(std::move(task)); })
+{
+    static_assert(!std::is_same<Backend, SpscRingBackend>::value,
+                  "WorkerPool needs a multi-producer/multi-consumer queue; "
+                  "SpscRingBackend supports one producer and one consumer only");
+}
+
+/*****************************************************************************/
+
+/**
+ * @brief Packages `f(args...)` with its future and enqueues it.
+ *
+ * @details
+ * GIVEN a callable and its arguments,
+ * WHEN `submit(f, args...)` is called,
+ * THEN `make_future_task()` builds the single-allocation task/future pair, the task
+ * is queued through the fire-and-forget overload and the future is returned.
+ */
+template <typename F, typename... Args, typename>
+TaskFuture<TaskResultOf<F, Args...>> WorkerPool::submit(F&& f, Args&&... args)
+{
+    auto packaged = make_future_task(std::forward<F>(f), std::forward<Args>(args)...);
+    submit(std::move(packaged.first));
+    return std::move(packaged.second);
+}
+
+template <typename F, typename... Args>
+TaskFuture<TaskResultOf<F, Args...>> WorkerPool::submit(Priority priority, F&& f, Args&&... args)
+{
+    auto packaged = make_future_task(std::forward<F>(f), std::forward<Args>(args)...);
+    submit(std::move(packaged.first), priority);
+    return std::move(packaged.second);
+}
+
+template <typename F, typename... Args>
+TaskFuture<TaskResultOf<F, Args...>> WorkerPool::submit(const CancellationToken& token, F&& f,
+                                                        Args&&... args)
+{
+    auto packaged = make_future_task(std::forward<F>(f), std::forward<Args>(args)...);
+    submit(std::move(packaged.first), token);
+    return std::move(packaged.second);
+}
+
+template <typename F, typename... Args>
+TaskFuture<TaskResultOf<F, Args...>> WorkerPool::submit(
+    std::chrono::steady_clock::time_point deadline, F&& f, Args&&... args)
+{
+    auto packaged = make_future_task(std::forward<F>(f), std::forward<Args>(args)...);
+    submit(std::move(packaged.first), deadline);
+    return std::move(packaged.second);
+}
+
+/*****************************************************************************/
+
+template <typename Rep, typename Period>
+TimerHandle WorkerPool::schedule_after(const std::chrono::duration<Rep, Period>& delay, Task task)
+{
+    return schedule_at(std::chrono::steady_clock::now() +
+                           std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay),
+                       std::move(task));
+}
+
+/**
+ * @brief Registers a periodic timer whose first run is due one `period` from now.
+ *
+ * @details
+ * Periods shorter than one wheel tick are rounded up to a tick.
+ */
+template <typename Rep, typename Period>
+TimerHandle WorkerPool::schedule_every(const std::chrono::duration<Rep, Period>& period, Task task)
+{
+    using duration      = std::chrono::steady_clock::duration;
+    const auto interval = std::max(std::chrono::duration_cast<duration>(period),
+                                   std::chrono::duration_cast<duration>(TimerWheel::TICK));
+    return timers.schedule(std::chrono::steady_clock::now() + interval, interval, std::move(task));
+}
+
+/*****************************************************************************/
+
+/**
+ * @brief Waits at most `timeout` for the in-flight counter to reach zero.
+ *
+ * @param timeout Maximum time to wait.
+ * @return `true` if the pool became idle in time.
+ */
+template <typename Rep, typename Period>
+bool WorkerPool::wait_idle_for(const std::chrono::duration<Rep, Period>& timeout)
+{
+    std::unique_lock<std::mutex> lock(idle_mtx);
+    return idle_cv.wait_for(lock, timeout, [this] { return in_flight.load() == 0; });
+}
+
+/*****************************************************************************/
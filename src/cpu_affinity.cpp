@@ -0,0 +1,235 @@
+/**
+ * @file        cpu_affinity.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-04>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the CpuAffinity helpers.
+ *
+ * @details
+ * The Linux implementation relies on `sched_getaffinity()` for the process cpuset,
+ * on sysfs for the package/core topology and on `pthread_setaffinity_np()` to pin
+ * threads. Other platforms report every hardware thread as allowed and never pin.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/* Project libraries */
+
+#include "cpu_affinity.h"
+
+/*****************************************************************************/
+
+/* Internal helpers */
+
+/**
+ * @brief Reads an integer topology attribute of `cpu` from sysfs.
+ *
+ * @return The value, or `fallback` if the file is missing or unreadable.
+ */
+static int read_topology_value(int cpu, const char* attribute, int fallback)
+{
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" +
+                       attribute);
+    int value = fallback;
+    if (!(file >> value))
+        return fallback;
+    return value;
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Returns the CPUs of the process cpuset.
+ *
+ * @details
+ * On Linux this honors `taskset`, cgroup cpusets and container CPU limits expressed
+ * as a cpuset. Elsewhere it returns `0 .. hardware_concurrency() - 1`.
+ */
+std::vector<int> CpuAffinity::allowed_cpus()
+{
+    std::vector<int> cpus;
+
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &set))
+                cpus.push_back(cpu);
+        }
+        return cpus;
+    }
+#endif
+
+    const unsigned count = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned cpu = 0; cpu < count; cpu++)
+        cpus.push_back(static_cast<int>(cpu));
+    return cpus;
+}
+
+/**
+ * @brief Returns package and core ids for every allowed CPU.
+ */
+std::vector<CpuTopology> CpuAffinity::topology()
+{
+    std::vector<CpuTopology> cpus;
+    for (int cpu : allowed_cpus())
+    {
+        cpus.push_back({cpu, read_topology_value(cpu, "physical_package_id", 0),
+                        read_topology_value(cpu, "core_id", cpu)});
+    }
+    return cpus;
+}
+
+/**
+ * @brief Orders CPUs for compact or scatter placement.
+ *
+ * @details
+ * GIVEN 2 packages × 2 cores × 2 hardware threads (CPUs 0-7),
+ * WHEN ordered `Compact`,
+ * THEN SMT siblings come first, then the next core, then the next package;
+ * WHEN ordered `Scatter`,
+ * THEN the first hardware thread of every core comes first, alternating packages,
+ * and SMT siblings are only used once every core has a worker.
+ */
+std::vector<int> CpuAffinity::order(AffinityMode mode, std::vector<CpuTopology> cpus)
+{
+    std::vector<int> ordered;
+
+    if (mode == AffinityMode::Compact)
+    {
+        std::sort(cpus.begin(), cpus.end(), [](const CpuTopology& a, const CpuTopology& b) {
+            if (a.package != b.package)
+                return a.package < b.package;
+            if (a.core != b.core)
+                return a.core < b.core;
+            return a.cpu < b.cpu;
+        });
+        for (const auto& info : cpus)
+            ordered.push_back(info.cpu);
+        return ordered;
+    }
+
+    if (mode == AffinityMode::Scatter)
+    {
+        // package -> core -> hardware threads
+        std::map<int, std::map<int, std::vector<int>>> layout;
+        for (const auto& info : cpus)
+            layout[info.package][info.core].push_back(info.cpu);
+
+        std::vector<std::vector<std::vector<int>>> packages;
+        std::size_t                                max_cores   = 0;
+        std::size_t                                max_threads = 0;
+        for (auto& package : layout)
+        {
+            std::vector<std::vector<int>> cores;
+            for (auto& core : package.second)
+            {
+                std::sort(core.second.begin(), core.second.end());
+                max_threads = std::max(max_threads, core.second.size());
+                cores.push_back(core.second);
+            }
+            max_cores = std::max(max_cores, cores.size());
+            packages.push_back(cores);
+        }
+
+        for (std::size_t t = 0; t < max_threads; t++)
+            for (std::size_t c = 0; c < max_cores; c++)
+                for (const auto& cores : packages)
+                    if (c < cores.size() && t < cores[c].size())
+                        ordered.push_back(cores[c][t]);
+        return ordered;
+    }
+
+    for (const auto& info : cpus)
+        ordered.push_back(info.cpu);
+    return ordered;
+}
+
+/**
+ * @brief Builds the CPU slots for `policy`.
+ *
+ * @details
+ * `CpuList` entries outside the process cpuset are dropped, so a pool configured for
+ * a larger machine still starts on a smaller one.
+ */
+std::vector<std::vector<int>> CpuAffinity::plan(const AffinityPolicy& policy)
+{
+    std::vector<std::vector<int>> slots;
+
+    switch (policy.mode)
+    {
+        case AffinityMode::None:
+            break;
+
+        case AffinityMode::Compact:
+        case AffinityMode::Scatter:
+            for (int cpu : order(policy.mode, topology()))
+                slots.push_back({cpu});
+            break;
+
+        case AffinityMode::CpuList:
+        {
+            const std::vector<int> allowed = allowed_cpus();
+            for (int cpu : policy.cpus)
+            {
+                if (std::find(allowed.begin(), allowed.end(), cpu) != allowed.end())
+                    slots.push_back({cpu});
+            }
+            break;
+        }
+
+        case AffinityMode::ProcessCpuset:
+        {
+            std::vector<int> allowed = allowed_cpus();
+            if (!allowed.empty())
+                slots.push_back(allowed);
+            break;
+        }
+    }
+
+    return slots;
+}
+
+/**
+ * @brief Applies `cpus` as the affinity mask of `thread`.
+ */
+bool CpuAffinity::pin(std::thread& thread, const std::vector<int>& cpus)
+{
+#ifdef __linux__
+    if (cpus.empty())
+        return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)cpus;
+    return false;
+#endif
+}
+
+/*****************************************************************************/
@@ -0,0 +1,181 @@
+/**
+ * @file        latency_histogram.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-08>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the log-linear LatencyHistogram.
+ *
+ * @details
+ * Bucket layout for `SUB_BUCKET_BITS = S`:
+ * - values `< 2^S` map to bucket `value` (exact);
+ * - a value whose highest set bit is `m >= S` maps to major bucket `m - S + 1` and to
+ *   sub-bucket `(value >> (m - S)) - 2^S`, i.e. its `S` bits below the leading one.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <cmath>
+
+/* Project libraries */
+
+#include "latency_histogram.h"
+
+/*****************************************************************************/
+
+/* Static member definitions */
+
+constexpr int         LatencyHistogram::SUB_BUCKET_BITS;
+constexpr std::size_t LatencyHistogram::BUCKET_COUNT;
+
+/*****************************************************************************/
+
+/* Internal helpers */
+
+/**
+ * @brief Returns the index of the highest set bit of a non-zero `value`.
+ */
+static int highest_bit(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1)
+        bit++;
+    return bit;
+#endif
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+LatencyHistogram::LatencyHistogram() : samples(0), largest(0)
+{
+    for (auto& bucket : buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds one sample.
+ *
+ * @details
+ * GIVEN the worker that owns this histogram,
+ * WHEN a task latency is recorded,
+ * THEN one bucket, the sample count and possibly the maximum are updated with plain
+ * relaxed stores: no lock and no atomic read-modify-write.
+ */
+void LatencyHistogram::record(std::chrono::nanoseconds value) noexcept
+{
+    const std::uint64_t ns = value.count() > 0 ? static_cast<std::uint64_t>(value.count()) : 0;
+
+    std::atomic<std::uint64_t>& bucket = buckets[bucket_index(ns)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    samples.store(samples.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (ns > largest.load(std::memory_order_relaxed))
+        largest.store(ns, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept
+{
+    for (std::size_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        const std::uint64_t add = other.buckets[i].load(std::memory_order_relaxed);
+        if (add != 0)
+            buckets[i].store(buckets[i].load(std::memory_order_relaxed) + add,
+                             std::memory_order_relaxed);
+    }
+    samples.store(samples.load(std::memory_order_relaxed) +
+                      other.samples.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+    largest.store(std::max(largest.load(std::memory_order_relaxed),
+                           other.largest.load(std::memory_order_relaxed)),
+                  std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::count() const noexcept
+{
+    return samples.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Summarizes the distribution.
+ *
+ * @details
+ * The total is recomputed from the buckets, so a snapshot taken while the owner is
+ * recording stays self-consistent.
+ */
+LatencySummary LatencyHistogram::summary() const
+{
+    std::uint64_t total = 0;
+    for (const auto& bucket : buckets)
+        total += bucket.load(std::memory_order_relaxed);
+
+    LatencySummary result;
+    result.count = total;
+    if (total == 0)
+        return result;
+
+    const std::uint64_t max_ns = largest.load(std::memory_order_relaxed);
+    auto                clamp  = [max_ns](std::uint64_t ns) {
+        return std::chrono::nanoseconds(static_cast<std::int64_t>(std::min(ns, max_ns)));
+    };
+
+    result.p50  = clamp(value_at(0.50, total));
+    result.p99  = clamp(value_at(0.99, total));
+    result.p999 = clamp(value_at(0.999, total));
+    result.max  = clamp(max_ns);
+    return result;
+}
+
+std::size_t LatencyHistogram::bucket_index(std::uint64_t value) noexcept
+{
+    const std::uint64_t sub_count = std::uint64_t(1) << SUB_BUCKET_BITS;
+    if (value < sub_count)
+        return static_cast<std::size_t>(value);
+
+    const int           shift = highest_bit(value) - SUB_BUCKET_BITS;
+    const std::uint64_t sub   = (value >> shift) - sub_count;
+    return (static_cast<std::size_t>(shift + 1) << SUB_BUCKET_BITS) + static_cast<std::size_t>(sub);
+}
+
+std::uint64_t LatencyHistogram::bucket_upper_bound(std::size_t index) noexcept
+{
+    const std::size_t   major     = index >> SUB_BUCKET_BITS;
+    const std::uint64_t sub_count = std::uint64_t(1) << SUB_BUCKET_BITS;
+    const std::uint64_t sub       = index & (sub_count - 1);
+    if (major == 0)
+        return sub;
+
+    const int           shift = static_cast<int>(major) - 1;
+    const std::uint64_t low   = (sub_count + sub) << shift;
+    return low + ((std::uint64_t(1) << shift) - 1);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Walks the buckets until `ceil(quantile * total)` samples are covered.
+ */
+std::uint64_t LatencyHistogram::value_at(double quantile, std::uint64_t total) const noexcept
+{
+    const auto target = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(quantile * static_cast<double>(total))));
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target)
+            return bucket_upper_bound(i);
+    }
+    return bucket_upper_bound(BUCKET_COUNT - 1);
+}
+
+/*****************************************************************************/
@@ -7,33 +7,158 @@
  * @brief       Implementation of the thread-safe Logger class.
  *
  * @details
- * This file implements the static methods of the Logger utility,
- * including level filtering, formatted output, and time-stamping.
+ * This file implements the non-template static methods of the Logger utility,
+ * including formatted output, time-stamping and the asynchronous writer. Level
+ * filtering and message building are inline (`logger.ipp`).
  *
  * The Logger ensures that:
  * - Output from multiple threads is synchronized via a shared `std::mutex`.
  * - Messages are filtered according to the current `minLevel`.
  * - Each log line includes timestamp + severity + message.
+ *
+ * Asynchronous mode reuses the bounded Vyukov ring (`MpmcRingBackend`) as the
+ * hand-off between logging threads and a single writer thread. Producers only move a
+ * small record into the ring; the writer drains it in batches, formats every line
+ * into one reusable buffer and issues a single `write()` + flush per batch.
  */
 
 /*****************************************************************************/
 
 /* Standard libraries */
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <ctime>
-#include <iomanip>
 #include <iostream>
-#include <sstream>
+#include <iterator>
+#include <thread>
+#include <vector>
 
 /* Project libraries */
 #include "logger.h"
+#include "thread_safe_queue.h"
+
+/*****************************************************************************/
+
+/* Timestamp cache */
+
+/**
+ * @struct TimestampCache
+ * @brief Last calendar second formatted by the current thread.
+ */
+struct TimestampCache
+{
+    std::time_t second = -1; /**< Second `text` was built for (-1 = empty). */
+    char        text[20];    /**< `YYYY-MM-DD HH:MM:SS` plus the NUL `strftime()` writes. */
+};
+
+/**
+ * @brief Per-thread cache, so formatting never needs a lock.
+ */
+static thread_local TimestampCache timestamp_cache;
+
+/**
+ * @brief Length of the cached `YYYY-MM-DD HH:MM:SS` prefix.
+ */
+static constexpr std::size_t DATE_TIME_LENGTH = 19;
+
+/**
+ * @brief Writes the `digits` most significant digits of the 6-digit `micros` to `out`.
+ */
+static void write_fraction(char* out, long micros, int digits)
+{
+    for (int i = 5; i >= 0; --i)
+    {
+        if (i < digits)
+        {
+            out[i] = static_cast<char>('0' + micros % 10);
+        }
+        micros /= 10;
+    }
+}
+
+/*****************************************************************************/
+
+/* Asynchronous state */
+
+/**
+ * @struct LogRecord
+ * @brief Unformatted log entry handed from a logging thread to the writer.
+ */
+struct LogRecord
+{
+    Logger::Level                         level; /**< Severity. */
+    std::chrono::system_clock::time_point when;  /**< Time of the `log()` call. */
+    std::string                           msg;   /**< Message text. */
+};
+
+/**
+ * @brief State of the asynchronous mode.
+ *
+ * @details
+ * `producers` counts the `log()` calls currently between their `enabled` check and
+ * their push; it is only touched while asynchronous mode is on. A producer counts
+ * itself and then re-checks `enabled`. `stop_async()` clears `enabled` first and then
+ * waits for `producers` to reach zero before closing the ring, so no record is pushed
+ * into a closed ring and lost (both sides use sequentially consistent operations).
+ */
+struct Logger::AsyncState
+{
+    ~AsyncState() { stop(); }
+
+    /**
+     * @brief Drains and stops the writer, if running (see `Logger::stop_async()`).
+     */
+    void stop()
+    {
+        std::lock_guard<std::mutex> control(control_mtx);
+        if (!writer.joinable())
+        {
+            return;
+        }
+
+        enabled.store(false);
+        while (producers.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+
+        ring->close();
+        writer.join();
+    }
+
+    /**
+     * Records waiting for the writer; kept until the next `start_async()`. Stored in
+     * place because the ring is over-aligned and C++14 `new` ignores that alignment.
+     */
+    nonstd::optional<ThreadSafeQueue<LogRecord, MpmcRingBackend>> ring;
+
+    std::thread    writer;                         /**< Background writer thread. */
+    OverflowPolicy policy = OverflowPolicy::BLOCK; /**< Behavior on a full ring. */
+    std::mutex     control_mtx;                    /**< Serializes start/stop. */
+
+    std::atomic<bool>        enabled{false};  /**< `log()` enqueues instead of writing. */
+    std::atomic<std::size_t> producers{0};    /**< `log()` calls inside the enqueue path. */
+    std::atomic<std::size_t> enqueued{0};     /**< Records accepted by the ring. */
+    std::atomic<std::size_t> dropped{0};      /**< Records discarded on a full ring. */
+
+    std::mutex              flush_mtx;   /**< Guards `written`. */
+    std::condition_variable flush_cv;    /**< Signaled after every written batch. */
+    std::size_t             written = 0; /**< Records written by the writer. */
+};
 
 /*****************************************************************************/
 
 /* Static member initialization */
 
-std::mutex    Logger::mtx;
-Logger::Level Logger::minLevel = Logger::Level::INFO;
+std::mutex                Logger::mtx;
+std::atomic<Logger::Level> Logger::minLevel{Logger::Level::INFO};
+
+constexpr std::size_t Logger::DEFAULT_ASYNC_CAPACITY;
+constexpr std::size_t Logger::TIMESTAMP_BUFFER_SIZE;
+
+std::atomic<Logger::TimestampPrecision> Logger::precision{Logger::TimestampPrecision::SECONDS};
 
 /*****************************************************************************/
 
@@ -50,96 +175,156 @@ Logger::Level Logger::minLevel = Logger::Level::INFO;
  * THEN subsequent calls to `log()` will only print messages with
  * `level >= lvl`.
  *
- * Thread-safe: uses a lock to protect shared configuration.
+ * Lock-free: logging threads read the level with a relaxed atomic load, so the
+ * filter never contends with console output.
  */
 void Logger::set_min_level(Level lvl)
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    minLevel = lvl;
+    minLevel.store(lvl, std::memory_order_relaxed);
 }
 
 /**
- * @brief Logs a debug message (`DBG` level).
- * @param msg Message to print.
+ * @brief Selects the number of sub-second digits in timestamps.
  *
  * @details
- * Wrapper for `log(Level::DBG, msg)`.
- * Typically used for verbose diagnostic information.
+ * Lock-free: formatting threads read the setting with a relaxed load.
  */
-void Logger::debug(const std::string& msg)
+void Logger::set_timestamp_precision(TimestampPrecision value)
 {
-    log(Level::DBG, msg);
+    precision.store(value, std::memory_order_relaxed);
 }
 
 /**
- * @brief Logs an informational message (`INFO` level).
- * @param msg Message to print.
+ * @brief Prints or enqueues a message that already passed the level filter.
+ *
+ * @param lvl Severity level of the message.
+ * @param msg Message text to print.
  *
  * @details
- * Wrapper for `log(Level::INFO, msg)`.
- * Used for high-level runtime information.
+ * GIVEN a message built by `log()` after its level check,
+ * WHEN `write()` is invoked,
+ * THEN the message is printed to `std::cout` as:
+ *    ```
+ *    [YYYY-MM-DD HH:MM:SS] [LEVEL] message
+ *    ```
+ *
+ * In asynchronous mode the message is only copied into a record and enqueued; the
+ * writer thread formats and prints it later, with the timestamp taken here.
+ *
+ * @note
+ * - Thread-safe: all access to `std::cout` is serialized with a mutex.
+ * - Flushes output immediately in synchronous mode.
  */
-void Logger::info(const std::string& msg)
+void Logger::write(Level lvl, const std::string& msg)
 {
-    log(Level::INFO, msg);
+    const auto when = std::chrono::system_clock::now();
+
+    // Synchronous logging never touches the shared `producers` counter.
+    AsyncState& state = async_state();
+    if (state.enabled.load())
+    {
+        // Re-check once counted: `stop_async()` may have cleared `enabled` in between.
+        state.producers.fetch_add(1);
+        if (state.enabled.load())
+        {
+            LogRecord record{lvl, when, msg};
+            bool      accepted;
+            if (state.policy == OverflowPolicy::BLOCK)
+                accepted = state.ring->push(std::move(record));
+            else
+                accepted = state.ring->try_push(std::move(record));
+
+            if (accepted)
+                state.enqueued.fetch_add(1, std::memory_order_relaxed);
+            else
+                state.dropped.fetch_add(1, std::memory_order_relaxed);
+
+            state.producers.fetch_sub(1);
+            return;
+        }
+        state.producers.fetch_sub(1);
+    }
+
+    // Reused per thread: once grown, formatting a line no longer allocates.
+    static thread_local std::string line;
+    line.clear();
+    format_line(line, lvl, when, msg);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    std::cout.write(line.data(), static_cast<std::streamsize>(line.size()));
+    std::cout.flush();
 }
 
 /**
- * @brief Logs a warning message (`WARN` level).
- * @param msg Message to print.
+ * @brief Starts the background writer.
  *
  * @details
- * Wrapper for `log(Level::WARN, msg)`.
- * Used for recoverable or unexpected events.
+ * GIVEN a logger in synchronous mode,
+ * WHEN `start_async(capacity, policy)` is called,
+ * THEN a ring of at least `capacity` records is allocated, the counters are reset and
+ * the writer thread is started before `log()` switches to enqueueing.
  */
-void Logger::warn(const std::string& msg)
+void Logger::start_async(std::size_t capacity, OverflowPolicy policy)
 {
-    log(Level::WARN, msg);
+    AsyncState&                 state = async_state();
+    std::lock_guard<std::mutex> control(state.control_mtx);
+    if (state.writer.joinable())
+    {
+        return;
+    }
+
+    state.ring.reset();
+    state.ring.emplace(capacity);
+    state.policy = policy;
+    state.enqueued.store(0);
+    state.dropped.store(0);
+    {
+        std::lock_guard<std::mutex> lock(state.flush_mtx);
+        state.written = 0;
+    }
+
+    state.writer = std::thread(&Logger::writer_loop);
+    state.enabled.store(true);
 }
 
 /**
- * @brief Logs an error message (`ERROR` level).
- * @param msg Message to print.
+ * @brief Stops the background writer after it has written every accepted record.
  *
  * @details
- * Wrapper for `log(Level::ERROR, msg)`.
- * Indicates a critical issue or failure.
+ * GIVEN a logger in asynchronous mode,
+ * WHEN `stop_async()` is called,
+ * THEN new `log()` calls write synchronously again, in-flight enqueues are allowed to
+ * finish, the ring is closed and the writer exits once it has drained it.
  */
-void Logger::error(const std::string& msg)
+void Logger::stop_async()
 {
-    log(Level::ERROR, msg);
+    async_state().stop();
 }
 
 /**
- * @brief Core method that handles message formatting and output.
- *
- * @param lvl Severity level of the message.
- * @param msg Message text to print.
- *
- * @details
- * GIVEN a message and a severity level,
- * WHEN `log()` is invoked,
- * THEN:
- *  - If `lvl < minLevel`, the message is ignored.
- *  - Otherwise, the message is printed to `std::cout` as:
- *    ```
- *    [YYYY-MM-DD HH:MM:SS] [LEVEL] message
- *    ```
- *
- * @note
- * - Thread-safe: all access to `std::cout` is serialized with a mutex.
- * - Uses `std::endl` to flush output immediately.
+ * @brief Waits until the writer has printed every record accepted before the call.
  */
-void Logger::log(Level lvl, const std::string& msg)
+void Logger::flush()
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    if (static_cast<int>(lvl) < static_cast<int>(minLevel))
+    AsyncState& state = async_state();
+    if (state.enabled.load())
     {
+        const std::size_t            target = state.enqueued.load();
+        std::unique_lock<std::mutex> lock(state.flush_mtx);
+        state.flush_cv.wait(lock, [&state, target] { return state.written >= target; });
         return;
     }
 
-    std::cout << "[" << timestamp() << "] "
-              << "[" << levelToString(lvl) << "] " << msg << std::endl;
+    std::lock_guard<std::mutex> lock(mtx);
+    std::cout.flush();
+}
+
+/**
+ * @brief Returns the number of records dropped since the last `start_async()`.
+ */
+std::size_t Logger::dropped_count()
+{
+    return async_state().dropped.load(std::memory_order_relaxed);
 }
 
 /*****************************************************************************/
@@ -147,37 +332,155 @@ void Logger::log(Level lvl, const std::string& msg)
 /* Private Methods */
 
 /**
- * @brief Returns the current timestamp in "YYYY-MM-DD HH:MM:SS" format.
+ * @brief Drains the ring in batches until it is closed and empty.
+ *
+ * @details
+ * Each batch is formatted into a reusable buffer and written with a single
+ * `std::cout.write()` under the console mutex. With `OverflowPolicy::COUNT_DROPS`
+ * a warning with the number of newly dropped records is appended to the batch, and
+ * once more before exiting so drops after the last batch are not missed.
+ */
+void Logger::writer_loop()
+{
+    constexpr std::size_t BATCH_SIZE = 256;
+
+    AsyncState&            state = async_state();
+    std::vector<LogRecord> batch;
+    std::string            buffer;
+    std::size_t            reported = 0;
+    batch.reserve(BATCH_SIZE);
+
+    for (;;)
+    {
+        batch.clear();
+        const std::size_t count = state.ring->pop_bulk(std::back_inserter(batch), BATCH_SIZE);
+
+        buffer.clear();
+        for (const LogRecord& record : batch)
+        {
+            format_line(buffer, record.level, record.when, record.msg);
+        }
+
+        if (state.policy == OverflowPolicy::COUNT_DROPS)
+        {
+            const std::size_t dropped = state.dropped.load(std::memory_order_relaxed);
+            if (dropped != reported)
+            {
+                format_line(buffer, Level::WARN, std::chrono::system_clock::now(),
+                            "Logger dropped " + std::to_string(dropped - reported) +
+                                " records (ring full)");
+                reported = dropped;
+            }
+        }
+
+        if (!buffer.empty())
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            std::cout.flush();
+        }
+
+        // Closed and drained: the final drop report (if any) has just been written.
+        if (count == 0)
+        {
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(state.flush_mtx);
+            state.written += count;
+        }
+        state.flush_cv.notify_all();
+    }
+}
+
+/**
+ * @brief Returns the asynchronous state, constructed on first use.
+ */
+Logger::AsyncState& Logger::async_state()
+{
+    static AsyncState state;
+    return state;
+}
+
+/**
+ * @brief Appends `[timestamp] [LEVEL] msg\n` to `out`.
+ */
+void Logger::format_line(std::string&                          out,
+                         Level                                 lvl,
+                         std::chrono::system_clock::time_point when,
+                         const std::string&                    msg)
+{
+    char              stamp[TIMESTAMP_BUFFER_SIZE];
+    const std::size_t length = timestamp(when, stamp);
+
+    out += '[';
+    out.append(stamp, length);
+    out += "] [";
+    out += levelToString(lvl);
+    out += "] ";
+    out += msg;
+    out += '\n';
+}
+
+/**
+ * @brief Writes `when` in "YYYY-MM-DD HH:MM:SS[.fraction]" format to `out`.
  *
  * @details
- * Internally uses `std::chrono::system_clock` and converts to `std::tm`
- * using the thread-safe functions:
+ * GIVEN consecutive calls on the same thread,
+ * WHEN `when` falls in the same second as the previous call,
+ * THEN the cached calendar text is copied and only the fraction is written;
+ * otherwise it is rebuilt with the thread-safe conversion functions:
  * - `localtime_s()` on Windows.
  * - `localtime_r()` on POSIX systems.
  *
  * Example:
  * ```
- * 2025-10-07 17:26:45
+ * 2025-10-07 17:26:45.042
  * ```
  *
- * @return Formatted timestamp string.
+ * @return Number of characters written.
  */
-std::string Logger::timestamp()
+std::size_t Logger::timestamp(std::chrono::system_clock::time_point when, char* out)
 {
-    using clock           = std::chrono::system_clock;
-    const auto        now = clock::now();
-    const std::time_t tt  = clock::to_time_t(now);
+    using namespace std::chrono;
 
-    std::tm tm{};
+    // Floor to the second so that times before the epoch keep a positive fraction.
+    auto seconds_part = time_point_cast<seconds>(when);
+    if (seconds_part > when)
+    {
+        seconds_part -= seconds(1);
+    }
+    const std::time_t tt = system_clock::to_time_t(seconds_part);
+
+    if (timestamp_cache.second != tt)
+    {
+        std::tm tm{};
 #if defined(_WIN32)
-    localtime_s(&tm, &tt);
+        localtime_s(&tm, &tt);
 #else
-    localtime_r(&tt, &tm);
+        localtime_r(&tt, &tm);
 #endif
+        std::strftime(timestamp_cache.text, sizeof(timestamp_cache.text), "%Y-%m-%d %H:%M:%S",
+                      &tm);
+        timestamp_cache.second = tt;
+    }
+    std::memcpy(out, timestamp_cache.text, DATE_TIME_LENGTH);
 
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-    return oss.str();
+    const long micros = static_cast<long>(duration_cast<microseconds>(when - seconds_part).count());
+    switch (precision.load(std::memory_order_relaxed))
+    {
+        case TimestampPrecision::MILLISECONDS:
+            out[DATE_TIME_LENGTH] = '.';
+            write_fraction(out + DATE_TIME_LENGTH + 1, micros, 3);
+            return DATE_TIME_LENGTH + 4;
+        case TimestampPrecision::MICROSECONDS:
+            out[DATE_TIME_LENGTH] = '.';
+            write_fraction(out + DATE_TIME_LENGTH + 1, micros, 6);
+            return DATE_TIME_LENGTH + 7;
+        default:
+            return DATE_TIME_LENGTH;
+    }
 }
 
 /**
@@ -33,7 +33,6 @@
 
 /* Standard libraries */
 #include <mutex>
-#include <sstream>
 
 /* Project libraries */
 #include "logger.h"
@@ -64,9 +63,9 @@ int main()
     /**************************************************************************/
     /* 1. Create shared queue and worker pool                                 */
     /**************************************************************************/
-    ThreadSafeQueue<std::function<void()>> queue;
-    WorkerPool                             pool(queue);
-    std::mutex                             cout_mtx;
+    ThreadSafeQueue<Task> queue;
+    WorkerPool            pool(queue);
+    std::mutex            cout_mtx;
 
     /**************************************************************************/
     /* 2. Configure logger verbosity                                          */
@@ -92,18 +91,15 @@ int main()
                 // Protect standard output
                 std::lock_guard<std::mutex> lock(cout_mtx);
 
-                std::ostringstream oss;
-                oss << "[Main] Task " << i
-                    << " completed in thread: " << std::this_thread::get_id();
-
-                Logger::info(oss.str());
+                Logger::info("[Main] Task ", i, " completed in thread: ",
+                             std::this_thread::get_id());
             });
     }
 
     /**************************************************************************/
     /* 5. Wait and stop workers gracefully                                    */
     /**************************************************************************/
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    pool.wait_idle();
     pool.stop();
 
     /**************************************************************************/
@@ -0,0 +1,159 @@
+/**
+ * @file        strand.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-11>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the Strand serial executor.
+ *
+ * @details
+ * Ordering relies on a single invariant: `scheduled` is `true` exactly while one
+ * drain task is queued or running. It is set by the submit that finds the strand
+ * idle and cleared by the drain that finds it empty, both under `mtx`, so two drains
+ * of the same strand can never coexist. A drain task the pool rejects never runs, so
+ * `abandon()` clears the flag itself, under `mtx`, together with the tasks it was meant
+ * to run.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <exception>
+#include <utility>
+
+/* Project libraries */
+
+#include "logger.h"
+#include "strand.h"
+
+/*****************************************************************************/
+
+/* Static member definitions */
+
+constexpr std::size_t Strand::BATCH_LIMIT;
+
+thread_local const Strand::State* Strand::current = nullptr;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+Strand::Strand(WorkerPool& pool) : state(std::make_shared<State>(pool)) {}
+
+/**
+ * @brief Queues `task` and schedules a drain task if the strand was idle.
+ */
+void Strand::submit(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        state->tasks.push_back(std::move(task));
+        if (state->scheduled)
+            return;
+        state->scheduled = true;
+    }
+
+    if (!schedule(state))
+        abandon(state);
+}
+
+bool Strand::running_in_this_thread() const
+{
+    return current == state.get();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Runs the strand's tasks in order, then releases the worker.
+ *
+ * @details
+ * GIVEN a drain task picked up by a worker,
+ * WHEN it runs,
+ * THEN it pops and runs one task at a time (the lock is not held while a task runs);
+ * once the strand is empty it clears `scheduled` and returns, and after
+ * `BATCH_LIMIT` tasks it resubmits itself behind the work already queued in the pool,
+ * so a busy strand cannot monopolize a worker. If the pool refuses the resubmission
+ * (it is stopping), this drain simply keeps going on the current worker.
+ *
+ * Cancelled and expired tasks are filtered through `WorkerPool::discard_if_stale()`.
+ */
+void Strand::drain(const std::shared_ptr<State>& state)
+{
+    const State* previous = current;
+    current               = state.get();
+
+    std::size_t done = 0;
+    while (true)
+    {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(state->mtx);
+            if (state->tasks.empty())
+            {
+                state->scheduled = false;
+                break;
+            }
+            if (done < BATCH_LIMIT)
+            {
+                task = std::move(state->tasks.front());
+                state->tasks.pop_front();
+            }
+        }
+
+        if (done == BATCH_LIMIT)
+        {
+            if (schedule(state))
+                break;
+            done = 0;
+            continue;
+        }
+
+        done++;
+        if (state->pool.discard_if_stale(task))
+            continue;
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            Logger::error("[Strand] Exception: ", e.what());
+        }
+    }
+
+    current = previous;
+}
+
+bool Strand::schedule(const std::shared_ptr<State>& state)
+{
+    std::shared_ptr<State> shared = state;
+    return state->pool.submit(Task([shared] { drain(shared); }));
+}
+
+/**
+ * @brief Releases the pending tasks outside the lock.
+ *
+ * @details
+ * Destroying a future-returning task breaks its promise, which may run continuations
+ * that submit to this same strand, so the tasks are moved out before they are
+ * destroyed.
+ */
+void Strand::abandon(const std::shared_ptr<State>& state)
+{
+    std::deque<Task> dropped;
+    {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        dropped.swap(state->tasks);
+        state->scheduled = false;
+    }
+
+    if (!dropped.empty())
+        Logger::warn("[Strand] Pool rejected the strand, ", dropped.size(), " tasks dropped");
+}
+
+/*****************************************************************************/
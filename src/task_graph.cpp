@@ -0,0 +1,255 @@
+/**
+ * @file        task_graph.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-13>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of the TaskGraph execution engine.
+ *
+ * @details
+ * The predecessor counts use acquire-release decrements, so whatever a node wrote is
+ * visible to the successor that brings the count to zero, whichever worker runs it.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <stdexcept>
+#include <utility>
+
+/* Project libraries */
+
+#include "task_graph.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+TaskGraph::TaskGraph()
+    : validated(true), pool(nullptr), remaining(0), failed(false), running(false)
+{
+}
+
+TaskGraph::~TaskGraph()
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    done_cv.wait(lock, [this] { return !running; });
+}
+
+TaskGraph::NodeId TaskGraph::add_node(Task task)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (running)
+        throw std::logic_error("TaskGraph::add_node: graph is running");
+
+    nodes.emplace_back(std::move(task));
+    return nodes.size() - 1;
+}
+
+void TaskGraph::add_edge(NodeId from, NodeId to)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (running)
+        throw std::logic_error("TaskGraph::add_edge: graph is running");
+    if (from >= nodes.size() || to >= nodes.size())
+        throw std::out_of_range("TaskGraph::add_edge: unknown node");
+    if (from == to)
+        throw std::invalid_argument("TaskGraph::add_edge: self edge");
+
+    nodes[from].successors.push_back(to);
+    nodes[to].predecessors++;
+    validated = false;
+}
+
+/**
+ * @brief Resets the run state in place and submits the roots.
+ *
+ * @details
+ * Every count is reset before the first root is submitted, so a root finishing
+ * early can never observe a count left over from the previous run.
+ */
+void TaskGraph::start(WorkerPool& pool)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (running)
+            throw std::logic_error("TaskGraph::start: graph is already running");
+        if (!validated)
+        {
+            validate();
+            validated = true;
+        }
+        if (nodes.empty())
+            return;
+
+        for (auto& node : nodes)
+            node.pending.store(node.predecessors, std::memory_order_relaxed);
+        remaining.store(nodes.size(), std::memory_order_relaxed);
+        failed.store(false, std::memory_order_relaxed);
+        error      = nullptr;
+        this->pool = &pool;
+        running    = true;
+    }
+
+    for (NodeId id = 0; id < nodes.size(); id++)
+    {
+        if (nodes[id].predecessors == 0 && !dispatch(id))
+            execute(id);
+    }
+}
+
+void TaskGraph::wait()
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    done_cv.wait(lock, [this] { return !running; });
+
+    if (error)
+    {
+        std::exception_ptr thrown = error;
+        error                     = nullptr;
+        std::rethrow_exception(thrown);
+    }
+}
+
+void TaskGraph::run(WorkerPool& pool)
+{
+    start(pool);
+    wait();
+}
+
+std::size_t TaskGraph::size() const
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return nodes.size();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Kahn's algorithm over the predecessor counts.
+ *
+ * @details
+ * GIVEN the current nodes and edges,
+ * WHEN nodes are removed one by one once all their predecessors have been removed,
+ * THEN a node left over belongs to (or depends on) a cycle.
+ */
+void TaskGraph::validate() const
+{
+    std::vector<std::size_t> left(nodes.size());
+    std::vector<NodeId>      ready;
+    for (NodeId id = 0; id < nodes.size(); id++)
+    {
+        left[id] = nodes[id].predecessors;
+        if (left[id] == 0)
+            ready.push_back(id);
+    }
+
+    std::size_t visited = 0;
+    while (!ready.empty())
+    {
+        const NodeId id = ready.back();
+        ready.pop_back();
+        visited++;
+        for (NodeId next : nodes[id].successors)
+        {
+            if (--left[next] == 0)
+                ready.push_back(next);
+        }
+    }
+
+    if (visited != nodes.size())
+        throw std::logic_error("TaskGraph::start: graph contains a cycle");
+}
+
+/**
+ * @brief Submits a node; a rejection fails the run.
+ *
+ * @details
+ * GIVEN a pool whose queue has been closed by `stop()`,
+ * WHEN a ready node is dispatched,
+ * THEN the submit fails, the run is marked failed with a `std::runtime_error` and the
+ * caller executes the node inline: its body is skipped and its successors count down,
+ * so `remaining` still reaches zero and `wait()` returns.
+ */
+bool TaskGraph::dispatch(NodeId id)
+{
+    if (pool->submit(Task([this, id] { execute(id); })))
+        return true;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!error)
+        error = std::make_exception_ptr(
+            std::runtime_error("TaskGraph: the pool rejected a node"));
+    failed.store(true, std::memory_order_relaxed);
+    return false;
+}
+
+/**
+ * @brief Runs a node and releases its successors.
+ *
+ * @details
+ * GIVEN a node whose last predecessor just finished,
+ * WHEN it has run,
+ * THEN the first successor that becomes ready continues on this worker (no queue
+ * round-trip, warm caches) and the other ready successors are submitted to the pool.
+ * Successors the pool rejects are kept in `stranded` and executed (skipped) here too.
+ * The worker that finishes the last node ends the run and wakes `wait()`.
+ */
+void TaskGraph::execute(NodeId id)
+{
+    std::vector<NodeId> stranded;
+    while (true)
+    {
+        Node& node = nodes[id];
+        if (!failed.load(std::memory_order_relaxed))
+        {
+            try
+            {
+                node.task();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (!error)
+                    error = std::current_exception();
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        bool   has_next = false;
+        NodeId next     = 0;
+        for (NodeId successor : node.successors)
+        {
+            if (nodes[successor].pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                continue;
+            if (!has_next)
+            {
+                has_next = true;
+                next     = successor;
+            }
+            else if (!dispatch(successor))
+                stranded.push_back(successor);
+        }
+
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            running = false;
+            done_cv.notify_all();
+        }
+
+        if (!has_next)
+        {
+            if (stranded.empty())
+                return;
+            next = stranded.back();
+            stranded.pop_back();
+        }
+        id = next;
+    }
+}
+
+/*****************************************************************************/
@@ -0,0 +1,330 @@
+/**
+ * @file        timer_wheel.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2025-11-10>
+ * @version     1.0.0
+ *
+ * @brief       Implementation of TimerHandle and TimerWheel.
+ *
+ * @details
+ * Expired timers are collected under `mtx` and dispatched after releasing it, so a
+ * dispatch that blocks (bounded queue) never blocks `schedule()` callers.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+/* Project libraries */
+
+#include "timer_wheel.h"
+
+/*****************************************************************************/
+
+/* Static member definitions */
+
+constexpr std::chrono::milliseconds TimerWheel::TICK;
+constexpr std::size_t               TimerWheel::SLOT_COUNT;
+
+/*****************************************************************************/
+
+/* Internal helpers */
+
+/**
+ * @brief Tick value meaning "no timer stored".
+ */
+static constexpr std::uint64_t NO_TICK = std::numeric_limits<std::uint64_t>::max();
+
+/**
+ * @brief Number of whole ticks covering `period` (at least one).
+ */
+static std::uint64_t period_ticks(std::chrono::steady_clock::duration period)
+{
+    const auto tick  = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        TimerWheel::TICK);
+    const auto ticks = static_cast<std::uint64_t>((period + tick - std::chrono::nanoseconds(1)) /
+                                                  tick);
+    return std::max<std::uint64_t>(1, ticks);
+}
+
+/*****************************************************************************/
+
+/* TimerHandle */
+
+TimerHandle::TimerHandle(std::shared_ptr<TimerState> state) : state(std::move(state)) {}
+
+bool TimerHandle::cancel()
+{
+    if (!state)
+        return false;
+
+    int expected = TimerState::PENDING;
+    return state->status.compare_exchange_strong(expected, TimerState::CANCELLED);
+}
+
+bool TimerHandle::pending() const
+{
+    return state && state->status.load() == TimerState::PENDING;
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+TimerWheel::TimerWheel(Dispatch dispatch)
+    : dispatch(std::move(dispatch)),
+      origin(std::chrono::steady_clock::now()),
+      slots(SLOT_COUNT),
+      current(0),
+      count(0),
+      wake_tick(NO_TICK),
+      stopping(false)
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+    stop();
+}
+
+/**
+ * @brief Stores a new timer and wakes the thread only if it is due earlier than planned.
+ *
+ * @details
+ * GIVEN a wheel thread sleeping until tick 500,
+ * WHEN a timer due at tick 800 is scheduled,
+ * THEN it is appended to bucket `800 % SLOT_COUNT` and nobody is woken;
+ * WHEN a timer due at tick 20 is scheduled,
+ * THEN the thread is notified and sleeps until tick 20 instead.
+ */
+TimerHandle TimerWheel::schedule(std::chrono::steady_clock::time_point when,
+                                 std::chrono::steady_clock::duration period, Task task)
+{
+    auto state    = std::make_shared<TimerState>();
+    state->period = period;
+    state->task   = std::move(task);
+
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        const std::uint64_t         due = std::max(tick_of(when), current + 1);
+        insert_locked(Entry{due, state});
+
+        if (!worker.joinable())
+            worker = std::thread(&TimerWheel::run, this);
+        else if (due < wake_tick)
+            notify = true;
+    }
+    if (notify)
+        cv.notify_one();
+
+    return TimerHandle(std::move(state));
+}
+
+/**
+ * @brief Joins the thread, then cancels and drops every stored timer.
+ */
+void TimerWheel::stop()
+{
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+        thread   = std::move(worker);
+    }
+    cv.notify_all();
+    if (thread.joinable())
+        thread.join();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto& slot : slots)
+    {
+        for (auto& entry : slot)
+            entry.state->status.store(TimerState::CANCELLED);
+        slot.clear();
+    }
+    count     = 0;
+    wake_tick = NO_TICK;
+    stopping  = false;
+}
+
+std::size_t TimerWheel::size() const
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return count;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Sleeps until the next non-empty bucket, expires it and dispatches.
+ *
+ * @details
+ * The sleep is re-evaluated whenever `schedule()` notifies an earlier timer, so the
+ * thread neither polls at tick rate nor oversleeps a new deadline.
+ */
+void TimerWheel::run()
+{
+    std::vector<std::shared_ptr<TimerState>> fire_list;
+    std::unique_lock<std::mutex>             lock(mtx);
+
+    while (!stopping)
+    {
+        if (count == 0)
+        {
+            wake_tick = NO_TICK;
+            cv.wait(lock, [this] { return stopping || count != 0; });
+            continue;
+        }
+
+        wake_tick = next_tick_locked();
+        const auto wake_at =
+            origin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         TICK * static_cast<std::chrono::milliseconds::rep>(wake_tick));
+        if (std::chrono::steady_clock::now() < wake_at)
+        {
+            cv.wait_until(lock, wake_at);
+            continue;
+        }
+
+        expire_locked(tick_of(std::chrono::steady_clock::now()), fire_list);
+        wake_tick = NO_TICK;
+
+        lock.unlock();
+        for (const auto& state : fire_list)
+            fire(state);
+        fire_list.clear();
+        lock.lock();
+    }
+}
+
+std::uint64_t TimerWheel::tick_of(std::chrono::steady_clock::time_point when) const
+{
+    if (when <= origin)
+        return 0;
+
+    const auto tick = std::chrono::duration_cast<std::chrono::steady_clock::duration>(TICK);
+    return static_cast<std::uint64_t>((when - origin + tick - std::chrono::nanoseconds(1)) / tick);
+}
+
+void TimerWheel::insert_locked(Entry entry)
+{
+    slots[entry.due % SLOT_COUNT].push_back(std::move(entry));
+    count++;
+}
+
+std::uint64_t TimerWheel::next_tick_locked() const
+{
+    for (std::uint64_t tick = current + 1; tick <= current + SLOT_COUNT; tick++)
+    {
+        if (!slots[tick % SLOT_COUNT].empty())
+            return tick;
+    }
+    return current + SLOT_COUNT;
+}
+
+/**
+ * @brief Visits the buckets of ticks `current + 1 .. target`.
+ *
+ * @details
+ * GIVEN buckets holding due, not-yet-due and cancelled entries,
+ * WHEN the clock reaches `target`,
+ * THEN due entries are collected in `expired`, cancelled ones are dropped and the rest
+ * stay for a later revolution. A periodic timer is reinserted at its next due tick
+ * after `target` (missed runs are skipped, not replayed in a burst).
+ *
+ * At most one revolution is visited even if the thread fell far behind, since that
+ * already covers every bucket.
+ */
+void TimerWheel::expire_locked(std::uint64_t                             target,
+                               std::vector<std::shared_ptr<TimerState>>& expired)
+{
+    const std::uint64_t last = std::min(target, current + SLOT_COUNT);
+    std::vector<Entry>  again;
+
+    for (std::uint64_t tick = current + 1; tick <= last; tick++)
+    {
+        std::vector<Entry>& slot = slots[tick % SLOT_COUNT];
+        std::size_t         kept = 0;
+
+        for (std::size_t i = 0; i < slot.size(); i++)
+        {
+            Entry& entry = slot[i];
+            if (entry.state->status.load() == TimerState::CANCELLED)
+            {
+                count--;
+                continue;
+            }
+            if (entry.due > target)
+            {
+                if (kept != i)
+                    slot[kept] = std::move(entry);
+                kept++;
+                continue;
+            }
+
+            count--;
+            expired.push_back(entry.state);
+
+            const auto period = entry.state->period;
+            if (period != std::chrono::steady_clock::duration::zero())
+            {
+                const std::uint64_t step = period_ticks(period);
+                again.push_back(
+                    Entry{entry.due + step * ((target - entry.due) / step + 1), entry.state});
+            }
+        }
+        slot.resize(kept);
+    }
+
+    current = target;
+    for (auto& entry : again)
+        insert_locked(std::move(entry));
+}
+
+/**
+ * @brief Dispatches one expired timer.
+ *
+ * @details
+ * A one-shot timer moves its task out once it wins the PENDING -> FIRED race against
+ * `cancel()`. A periodic timer dispatches a small task that runs the stored callable
+ * in place; if the previous run is still in progress the tick is skipped, so runs of
+ * the same timer never overlap. If `dispatch` rejects that task it will never run,
+ * so `running` is cleared here and the next period fires normally.
+ */
+void TimerWheel::fire(const std::shared_ptr<TimerState>& state)
+{
+    if (state->period == std::chrono::steady_clock::duration::zero())
+    {
+        int expected = TimerState::PENDING;
+        if (state->status.compare_exchange_strong(expected, TimerState::FIRED))
+            dispatch(std::move(state->task));
+        return;
+    }
+
+    if (state->status.load() != TimerState::PENDING || state->running.exchange(true))
+        return;
+
+    std::shared_ptr<TimerState> shared = state;
+    const bool queued = dispatch(Task([shared] {
+        struct Reset
+        {
+            std::atomic<bool>& flag;
+            ~Reset() { flag.store(false); }
+        } reset{shared->running};
+
+        if (shared->status.load() == TimerState::PENDING)
+            shared->task();
+    }));
+
+    if (!queued)
+        state->running.store(false);
+}
+
+/*****************************************************************************/
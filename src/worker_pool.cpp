@@ -12,12 +12,17 @@
  * - Task submission and consumption.
  * - Graceful shutdown and queue coordination.
  *
- * The pool cooperates with a shared `ThreadSafeQueue<std::function<void()>>`
+ * The pool cooperates with a shared `ThreadSafeQueue<Task>`
  * to execute submitted tasks in parallel across multiple worker threads.
  */
 
 /*****************************************************************************/
 
+/* Standard libraries */
+
+#include <algorithm>
+#include <chrono>
+
 /* Project libraries */
 
 #include "worker_pool.h"
@@ -26,24 +31,29 @@
 
 /*****************************************************************************/
 
-/* Public Methods */
+/* Static member definitions */
+
+constexpr std::chrono::milliseconds WorkerPool::PARK_TIMEOUT;
+
+thread_local WorkerPool::WorkerHistograms* WorkerPool::current_histograms = nullptr;
+
+/*****************************************************************************/
+
+/* Thread-local state */
 
 /**
- * @brief Constructs a WorkerPool attached to a shared ThreadSafeQueue.
- *
- * @param queue Reference to the task queue shared among all workers.
- *
- * @details
- * GIVEN an existing queue instance,
- * WHEN the WorkerPool is constructed,
- * THEN it initializes its internal state but does not spawn any threads yet.
- *
- * The actual worker threads are created only after calling `start()`.
+ * @brief Pool whose worker is running on the current thread (`nullptr` elsewhere).
  */
-WorkerPool::WorkerPool(ThreadSafeQueue<std::function<void()>>& queue)
-    : task_queue(queue), running(false)
-{
-}
+static thread_local const WorkerPool* current_pool = nullptr;
+
+/**
+ * @brief Deque index of the worker running on the current thread.
+ */
+static thread_local std::size_t current_worker = 0;
+
+/*****************************************************************************/
+
+/* Public Methods */
 
 /**
  * @brief Destructor ensuring all threads are stopped and joined before cleanup.
@@ -72,7 +82,8 @@ WorkerPool::~WorkerPool()
  * THEN:
  * - Sets the `running` flag to `true`.
  * - Creates `number_workers` threads.
- * - Each thread executes the `run()` method with a unique worker name.
+ * - Each thread executes the `run()` method with a unique worker name
+ *   (`run_stealing()` in work-stealing mode, after creating one deque per worker).
  *
  * Example:
  * ```cpp
@@ -89,20 +100,79 @@ void WorkerPool::start(const int number_workers)
     if (running)
         return;
 
-    running = true;
-    Logger::info("[Worker Pool] Starting " + std::to_string(number_workers) + " workers");
-    for (int i = 0; i < number_workers; i++)
+    running  = true;
+    stopping = false;
+    elastic  = false;
+    Logger::info("[Worker Pool] Starting ", number_workers, " workers");
+
+    if (mode == SchedulingMode::WorkStealing)
     {
-        std::string name = std::string(DEFAULT_WORKER_NAME) + std::to_string(i);
+        deques.clear();
+        for (int i = 0; i < number_workers; i++)
+            deques.emplace_back(new WorkStealingDeque<Task*>());
+    }
+
+    std::lock_guard<std::mutex> lock(workers_mtx);
+    next_worker_id = 0;
+    for (int i = 0; i < number_workers; i++)
+        spawn_worker_locked();
+}
 
-        workers.emplace(name, std::thread([this, name]() { run(name); }));
+/**
+ * @brief Starts the pool with a worker count that follows the load.
+ *
+ * @param config Sizing policy.
+ *
+ * @details
+ * GIVEN an idle WorkerPool,
+ * WHEN `start_elastic()` is invoked,
+ * THEN `min_workers` threads running `run_elastic()` are created; `maybe_grow()` and
+ * `try_retire()` then keep the count between `min_workers` and `max_workers`.
+ *
+ * Example:
+ * ```cpp
+ * WorkerPool::ElasticConfig config;
+ * config.min_workers  = 2;
+ * config.max_workers  = 16;
+ * config.idle_timeout = std::chrono::seconds(30);
+ * pool.start_elastic(config);
+ * ```
+ */
+void WorkerPool::start_elastic(const ElasticConfig& config)
+{
+    if (mode == SchedulingMode::WorkStealing)
+    {
+        Logger::warn("[Worker Pool] Elastic sizing needs SchedulingMode::SharedQueue, starting ",
+                     config.max_workers, " fixed workers");
+        start(config.max_workers);
+        return;
     }
+
+    if (running)
+        return;
+
+    elastic_config             = config;
+    elastic_config.min_workers = std::max(1, config.min_workers);
+    elastic_config.max_workers = std::max(elastic_config.min_workers, config.max_workers);
+
+    running       = true;
+    stopping      = false;
+    elastic       = true;
+    backlog_since = 0;
+    Logger::info("[Worker Pool] Starting elastic pool with ", elastic_config.min_workers, " to ",
+                 elastic_config.max_workers, " workers");
+
+    std::lock_guard<std::mutex> lock(workers_mtx);
+    next_worker_id = 0;
+    for (int i = 0; i < elastic_config.min_workers; i++)
+        spawn_worker_locked();
 }
 
 /**
  * @brief Submits a task for execution by any available worker.
  *
- * @param task Callable object representing a unit of work.
+ * @param task     Callable object representing a unit of work.
+ * @param priority Level passed on to the queue; only `PriorityBackend` orders by it.
  *
  * @details
  * GIVEN an active WorkerPool,
@@ -117,11 +187,65 @@ void WorkerPool::start(const int number_workers)
  *
  * @note
  * Thread-safe.
- * If the queue is closed or the pool stopped, pushing may be ignored.
+ * If the queue is bounded and full, the call blocks until a worker frees a slot.
+ * If the queue is closed, the task is dropped, a warning is logged and `false` is
+ * returned.
+ * In work-stealing mode, calls made from one of this pool's workers push onto the
+ * worker's own deque; other callers go through the injection queue. Either way a
+ * parked worker is woken if there is one.
+ */
+bool WorkerPool::submit(Task task, Priority priority)
+{
+    if (task.cancellation_token().is_cancelled())
+    {
+        cancelled_tasks.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    in_flight.fetch_add(1, std::memory_order_relaxed);
+
+    if (instrumented.load(std::memory_order_relaxed))
+        task.set_submit_time(std::chrono::steady_clock::now());
+
+    if (mode == SchedulingMode::WorkStealing && current_pool == this)
+    {
+        deques[current_worker]->push(new Task(std::move(task)));
+        wake_one();
+        return true;
+    }
+
+    if (!task_queue->push(std::move(task), priority))
+    {
+        Logger::warn("[Worker Pool] Task rejected, queue is closed");
+        task_finished();
+        return false;
+    }
+
+    if (mode == SchedulingMode::WorkStealing)
+        wake_one();
+
+    if (elastic.load(std::memory_order_relaxed))
+        maybe_grow();
+    return true;
+}
+
+/**
+ * @brief Attaches `token` to the task and submits it.
  */
-void WorkerPool::submit(std::function<void()> task)
+bool WorkerPool::submit(Task task, CancellationToken token, Priority priority)
 {
-    task_queue.push(std::move(task));
+    task.set_cancellation_token(std::move(token));
+    return submit(std::move(task), priority);
+}
+
+/**
+ * @brief Stamps `deadline` on the task and submits it.
+ */
+bool WorkerPool::submit(Task task, std::chrono::steady_clock::time_point deadline,
+                        Priority priority)
+{
+    task.set_deadline(deadline);
+    return submit(std::move(task), priority);
 }
 
 /**
@@ -131,14 +255,15 @@ void WorkerPool::submit(std::function<void()> task)
  * GIVEN a running WorkerPool,
  * WHEN `stop()` is called,
  * THEN:
+ *  - Pending `schedule_*()` timers are cancelled and the timing wheel thread joined.
  *  - The `running` flag is set to `false`.
- *  - The pool waits briefly for remaining tasks to drain.
- *  - The queue is closed (`task_queue.close()`).
+ *  - The pool waits (`wait_idle()`) until every submitted task has run.
+ *  - The queue is closed (`task_queue->close()`).
  *  - All worker threads are joined safely.
  *
  * @note
- * - The function blocks until all threads finish.
- * - If the queue still contains tasks after the timeout, a warning is logged.
+ * - The function blocks until all submitted tasks and all threads finish.
+ * - No work is dropped and no polling is involved: the last finishing task wakes it.
  * - The method is idempotent (safe to call multiple times).
  *
  * @warning
@@ -147,35 +272,201 @@ void WorkerPool::submit(std::function<void()> task)
  */
 void WorkerPool::stop()
 {
+    timers.stop();
+
     if (!running)
         return;
 
     running = false;
 
     Logger::info("[Worker Pool] Stop requested, waiting for remaining tasks...");
-    auto start = std::chrono::steady_clock::now();
-    while (!task_queue.empty())
-    {
-        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    wait_idle();
 
-        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(1))
-        {
-            Logger::warn("[Worker Pool] Timeout waiting for queue to drain.");
-            break;
-        }
+    task_queue->close();
+    Logger::info("[Worker Pool] Task queue drained, closing...");
+
+    {
+        std::lock_guard<std::mutex> lock(park_mtx);
+        stopping = true;
     }
+    park_cv.notify_all();
 
-    task_queue.close();
-    Logger::info("[Worker Pool] Task queue drained, closing...");
+    // Take the threads out under the lock; retiring elastic workers also touch the map.
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(workers_mtx);
+        for (auto& worker_pair : workers)
+            threads.push_back(std::move(worker_pair.second));
+        for (auto& thread : retired)
+            threads.push_back(std::move(thread));
+        workers.clear();
+        retired.clear();
+        worker_cpus.clear();
+    }
 
-    for (auto& worker_pair : workers)
+    for (auto& thread : threads)
     {
-        auto& thread = worker_pair.second;
         if (thread.joinable())
             thread.join();
     }
 
-    workers.clear();
+    deques.clear();
+    live_workers = 0;
+    idle_workers = 0;
+    elastic      = false;
+}
+
+/**
+ * @brief Blocks until the in-flight task counter reaches zero.
+ *
+ * @details
+ * GIVEN tasks that are queued or executing,
+ * WHEN `wait_idle()` is called,
+ * THEN the caller sleeps on `idle_cv` and is woken by the worker that finishes the
+ * last task; no polling is involved.
+ */
+void WorkerPool::wait_idle()
+{
+    std::unique_lock<std::mutex> lock(idle_mtx);
+    idle_cv.wait(lock, [this] { return in_flight.load() == 0; });
+}
+
+/**
+ * @brief Hands `task` to the timing wheel, due at `when`.
+ *
+ * @details
+ * GIVEN a pool with no timer yet,
+ * WHEN the first task is scheduled,
+ * THEN the wheel starts its thread; later timers only append to a wheel bucket and
+ * wake that thread when they are due before the one it is sleeping for.
+ */
+TimerHandle WorkerPool::schedule_at(std::chrono::steady_clock::time_point when, Task task)
+{
+    return timers.schedule(when, std::chrono::steady_clock::duration::zero(), std::move(task));
+}
+
+/**
+ * @brief Returns the number of live worker threads.
+ *
+ * @details
+ * In elastic mode the value changes as workers are spawned and retired.
+ */
+std::size_t WorkerPool::worker_count() const
+{
+    return static_cast<std::size_t>(live_workers.load());
+}
+
+/**
+ * @brief Stores the CPU slots used to pin workers spawned from now on.
+ *
+ * @param policy Pinning policy.
+ *
+ * @details
+ * Example:
+ * ```cpp
+ * AffinityPolicy policy;
+ * policy.mode = AffinityMode::CpuList;
+ * policy.cpus = {2, 3, 4, 5};
+ * pool.set_affinity(policy);
+ * pool.start(4);  // Worker i runs on CPU 2 + i
+ * ```
+ */
+void WorkerPool::set_affinity(const AffinityPolicy& policy)
+{
+    std::vector<std::vector<int>> slots = CpuAffinity::plan(policy);
+    if (policy.mode != AffinityMode::None && slots.empty())
+        Logger::warn("[Worker Pool] Affinity policy matches no usable CPU, workers stay unpinned");
+
+    std::lock_guard<std::mutex> lock(workers_mtx);
+    affinity_slots = std::move(slots);
+}
+
+/**
+ * @brief Returns a snapshot of the mapping from worker name to pinned CPUs.
+ */
+std::unordered_map<std::string, std::vector<int>> WorkerPool::affinity_map() const
+{
+    std::lock_guard<std::mutex> lock(workers_mtx);
+    return worker_cpus;
+}
+
+/**
+ * @brief Turns task timestamping on or off.
+ *
+ * @details
+ * Tasks already queued keep whatever stamp they received at submit time.
+ */
+void WorkerPool::set_instrumentation(bool enabled)
+{
+    instrumented.store(enabled, std::memory_order_relaxed);
+}
+
+void WorkerPool::set_expiry_callback(ExpiryCallback callback)
+{
+    on_expired = std::move(callback);
+}
+
+/**
+ * @brief Drops a cancelled or expired task.
+ *
+ * @details
+ * The clock is only read for tasks that carry a deadline.
+ */
+bool WorkerPool::discard_if_stale(Task& task)
+{
+    if (task.cancellation_token().is_cancelled())
+    {
+        cancelled_tasks.fetch_add(1, std::memory_order_relaxed);
+        task = Task();
+        return true;
+    }
+
+    if (!task.has_deadline() || std::chrono::steady_clock::now() <= task.deadline())
+        return false;
+
+    expired_tasks.fetch_add(1, std::memory_order_relaxed);
+    if (on_expired)
+    {
+        try
+        {
+            on_expired(std::move(task));
+        }
+        catch (const std::exception& e)
+        {
+            Logger::error("[Worker Pool] Expiry callback exception: ", e.what());
+        }
+    }
+    task = Task();
+    return true;
+}
+
+/**
+ * @brief Merges the per-worker histograms into one snapshot.
+ *
+ * @details
+ * GIVEN workers recording concurrently,
+ * WHEN `stats()` is called,
+ * THEN their histograms are read with relaxed loads (no worker is blocked) and
+ * summed into private totals from which the percentiles are computed.
+ */
+WorkerPool::Stats WorkerPool::stats() const
+{
+    std::unique_ptr<WorkerHistograms> total(new WorkerHistograms());
+    {
+        std::lock_guard<std::mutex> lock(stats_mtx);
+        for (const auto& slot : histograms)
+        {
+            total->queue_wait.merge(slot->queue_wait);
+            total->run_time.merge(slot->run_time);
+        }
+    }
+
+    Stats result;
+    result.queue_wait = total->queue_wait.summary();
+    result.run_time   = total->run_time.summary();
+    result.cancelled  = cancelled_tasks.load(std::memory_order_relaxed);
+    result.expired    = expired_tasks.load(std::memory_order_relaxed);
+    return result;
 }
 
 /**
@@ -205,19 +496,92 @@ void WorkerPool::run(const std::string& worker_name)
 {
     for (;;)
     {
-        std::function<void()> task;
+        Task task;
 
-        if (!task_queue.pop(task))
+        if (!task_queue->pop(task))
             break;
 
-        try
+        execute(task, worker_name);
+    }
+}
+
+/**
+ * @brief Work-stealing worker loop.
+ *
+ * @param worker_name Name identifier of the worker thread.
+ * @param index       Index of the worker's own deque.
+ *
+ * @details
+ * GIVEN a pool started in `SchedulingMode::WorkStealing`,
+ * WHEN the worker runs out of local work,
+ * THEN it takes from the injection queue, then steals from other workers, and only
+ * parks when every source looked empty.
+ *
+ * The loop exits once `stop()` has closed the injection queue and no deque holds
+ * work. A task spawned by a running task lands on that worker's own deque, which its
+ * owner drains before it can exit, so no work is lost during shutdown.
+ */
+void WorkerPool::run_stealing(const std::string& worker_name, std::size_t index)
+{
+    current_pool   = this;
+    current_worker = index;
+
+    std::uint32_t seed = static_cast<std::uint32_t>(index) * 2654435761u + 1u;
+
+    for (;;)
+    {
+        Task task;
+
+        if (find_task(index, seed, task))
         {
-            task();
+            execute(task, worker_name);
+            continue;
         }
-        catch (const std::exception& e)
+
+        if (!park(PARK_TIMEOUT))
+            break;
+    }
+
+    current_pool = nullptr;
+}
+
+/**
+ * @brief Elastic worker loop.
+ *
+ * @param worker_name Name identifier of the worker thread.
+ *
+ * @details
+ * GIVEN a pool started with `start_elastic()`,
+ * WHEN the worker finds no task,
+ * THEN it blocks in the queue's `pop_for()` for at most `idle_timeout`; if the
+ * timeout expires without work it retires, unless the pool is already at
+ * `min_workers`, and otherwise starts a new idle period.
+ *
+ * Producers wake a waiting worker through the queue itself, so tasks pushed straight
+ * into the queue are picked up as promptly as submitted ones. The loop ends once
+ * `stop()` closes the queue and it has been drained.
+ */
+void WorkerPool::run_elastic(const std::string& worker_name)
+{
+    for (;;)
+    {
+        Task            task;
+        const PopStatus status = task_queue->pop_for(task, elastic_config.idle_timeout);
+
+        if (status == PopStatus::Closed)
+            break;
+
+        if (status == PopStatus::Item)
         {
-            Logger::error("[Worker Pool][" + worker_name + "] Exception: " + e.what());
+            idle_workers.fetch_sub(1);
+            maybe_grow();
+            execute(task, worker_name);
+            idle_workers.fetch_add(1);
+            continue;
         }
+
+        if (try_retire(worker_name))
+            return;
     }
 }
 
@@ -225,4 +589,336 @@ void WorkerPool::run(const std::string& worker_name)
 
 /* Private Methods */
 
+/**
+ * @brief Creates the next worker thread.
+ *
+ * @details
+ * Also joins the threads of previously retired elastic workers, which have already
+ * left their loop by the time they appear in `retired`.
+ */
+void WorkerPool::spawn_worker_locked()
+{
+    for (auto& thread : retired)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    retired.clear();
+
+    const int   id   = next_worker_id++;
+    std::string name = std::string(DEFAULT_WORKER_NAME) + std::to_string(id);
+
+    live_workers.fetch_add(1);
+
+    WorkerHistograms* stats_slot = acquire_histograms();
+
+    if (mode == SchedulingMode::WorkStealing)
+    {
+        const std::size_t index = static_cast<std::size_t>(id);
+        workers.emplace(name, std::thread([this, name, index, stats_slot]() {
+                            current_histograms = stats_slot;
+                            run_stealing(name, index);
+                            release_histograms(stats_slot);
+                        }));
+    }
+    else if (elastic)
+    {
+        // Counted as idle right away, so the same backlog does not spawn it twice.
+        idle_workers.fetch_add(1);
+        workers.emplace(name, std::thread([this, name, stats_slot]() {
+                            current_histograms = stats_slot;
+                            run_elastic(name);
+                            release_histograms(stats_slot);
+                        }));
+    }
+    else
+    {
+        workers.emplace(name, std::thread([this, name, stats_slot]() {
+                            current_histograms = stats_slot;
+                            run(name);
+                            release_histograms(stats_slot);
+                        }));
+    }
+
+    if (affinity_slots.empty())
+        return;
+
+    const std::size_t       slot = static_cast<std::size_t>(id) % affinity_slots.size();
+    const std::vector<int>& cpus = affinity_slots[slot];
+    if (CpuAffinity::pin(workers[name], cpus))
+        worker_cpus[name] = cpus;
+    else
+        Logger::warn("[Worker Pool] Could not pin ", name, ", running unpinned");
+}
+
+/**
+ * @brief Spawns one more elastic worker when the backlog calls for it.
+ *
+ * @details
+ * GIVEN no idle worker,
+ * WHEN at least `spawn_backlog` tasks are queued, or tasks have been queued without
+ * an idle worker for `spawn_wait`,
+ * THEN a worker is added, up to `max_workers`.
+ *
+ * The queued count is derived from the in-flight counter minus the busy workers,
+ * so no queue-specific size query is needed. The checks run lock-free; only an
+ * actual spawn takes `workers_mtx`.
+ */
+void WorkerPool::maybe_grow()
+{
+    if (idle_workers.load() > 0)
+    {
+        backlog_since.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    const int live = live_workers.load();
+    if (!running || live >= elastic_config.max_workers)
+        return;
+
+    const std::size_t busy   = static_cast<std::size_t>(live);
+    const std::size_t total  = in_flight.load();
+    const std::size_t queued = total > busy ? total - busy : 0;
+    if (queued == 0)
+        return;
+
+    const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch())
+                                 .count();
+    std::int64_t since = backlog_since.load();
+    if (since == 0 && backlog_since.compare_exchange_strong(since, now))
+        since = now;
+
+    const bool deep  = queued >= elastic_config.spawn_backlog;
+    const bool stale = std::chrono::nanoseconds(now - since) >= elastic_config.spawn_wait;
+    if (!deep && !stale)
+        return;
+
+    std::lock_guard<std::mutex> lock(workers_mtx);
+    if (!running || idle_workers.load() > 0 || live_workers.load() >= elastic_config.max_workers)
+        return;
+
+    spawn_worker_locked();
+    backlog_since.store(0, std::memory_order_relaxed);
+    Logger::info("[Worker Pool] Backlog of ", queued, " tasks, scaled up to ", live_workers.load(),
+                 " workers");
+}
+
+/**
+ * @brief Removes the calling worker from the pool if it is above `min_workers`.
+ *
+ * @details
+ * The worker's `std::thread` is moved to `retired` so that a later spawn or `stop()`
+ * joins it; a thread cannot join itself.
+ */
+bool WorkerPool::try_retire(const std::string& worker_name)
+{
+    std::lock_guard<std::mutex> lock(workers_mtx);
+    if (stopping || live_workers.load() <= elastic_config.min_workers)
+        return false;
+
+    auto it = workers.find(worker_name);
+    if (it != workers.end())
+    {
+        retired.push_back(std::move(it->second));
+        workers.erase(it);
+    }
+    worker_cpus.erase(worker_name);
+
+    live_workers.fetch_sub(1);
+    idle_workers.fetch_sub(1);
+    Logger::info("[Worker Pool] ", worker_name, " retired after idle timeout, ",
+                 live_workers.load(), " workers left");
+    return true;
+}
+
+/**
+ * @brief Looks for a task in the worker's deque, the injection queue and other deques.
+ *
+ * @details
+ * Victims are visited starting at a pseudo-random index so that thieves spread out
+ * instead of all hammering worker 0. After a successful steal or injection pop, one
+ * more parked worker is woken, since the source may still hold work.
+ */
+bool WorkerPool::find_task(std::size_t index, std::uint32_t& seed, Task& task)
+{
+    if (nonstd::optional<Task*> local = deques[index]->pop())
+    {
+        task = std::move(**local);
+        delete *local;
+        return true;
+    }
+
+    // Once stopping, the queue is closed: pop() no longer blocks and still drains it.
+    const bool from_queue = stopping ? task_queue->pop(task) : task_queue->try_pop(task);
+    if (from_queue)
+    {
+        wake_one();
+        return true;
+    }
+
+    const std::size_t count = deques.size();
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        const std::size_t victim = (seed + k) % count;
+        if (victim == index)
+            continue;
+
+        if (nonstd::optional<Task*> stolen = deques[victim]->steal())
+        {
+            task = std::move(**stolen);
+            delete *stolen;
+            wake_one();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool WorkerPool::has_work() const
+{
+    if (!task_queue->empty())
+        return true;
+
+    for (const auto& deque : deques)
+        if (!deque->empty())
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief Parks an idle worker until work is submitted, `timeout` elapses or the pool stops.
+ *
+ * @details
+ * The worker registers in `sleepers` and then rescans for work while holding
+ * `park_mtx`; `wake_one()` publishes work before reading `sleepers` and notifies under
+ * the same mutex. Both sides issue a sequentially consistent fence in between, so a
+ * submission either is seen by the rescan or finds the sleeper and wakes it.
+ */
+bool WorkerPool::park(std::chrono::steady_clock::duration timeout)
+{
+    std::unique_lock<std::mutex> lock(park_mtx);
+    sleepers.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool keep_running = true;
+    if (!has_work())
+    {
+        if (stopping)
+            keep_running = false;
+        else
+            park_cv.wait_for(lock, timeout);
+    }
+
+    sleepers.fetch_sub(1, std::memory_order_relaxed);
+    return keep_running;
+}
+
+void WorkerPool::wake_one()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_relaxed) == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(park_mtx);
+    }
+    park_cv.notify_one();
+}
+
+/**
+ * @brief Executes one task, catching and logging exceptions.
+ *
+ * @details
+ * A task whose cancellation token is cancelled is released without running, and so
+ * is a task dequeued after its deadline (once the expiry callback has seen it). Both
+ * still count as finished for `wait_idle()`.
+ */
+void WorkerPool::execute(Task& task, const std::string& worker_name)
+{
+    using clock = std::chrono::steady_clock;
+
+    if (discard_if_stale(task))
+    {
+        task_finished();
+        return;
+    }
+
+    const clock::time_point submitted = task.submit_time();
+    const bool              timed     = submitted != clock::time_point{};
+    clock::time_point       started;
+    if (timed)
+        started = clock::now();
+
+    try
+    {
+        task();
+    }
+    catch (const std::exception& e)
+    {
+        Logger::error("[Worker Pool][", worker_name, "] Exception: ", e.what());
+    }
+
+    if (timed && current_histograms != nullptr)
+    {
+        current_histograms->queue_wait.record(started - submitted);
+        current_histograms->run_time.record(clock::now() - started);
+    }
+
+    // Release captured state before reporting completion to wait_idle().
+    task = Task();
+    task_finished();
+}
+
+/**
+ * @brief Marks one task as finished.
+ *
+ * @details
+ * Only the task that brings the counter to zero touches `idle_mtx`, so the common
+ * path is a single atomic decrement. Locking before notifying closes the window
+ * between a waiter's predicate check and its sleep.
+ */
+void WorkerPool::task_finished()
+{
+    if (in_flight.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(idle_mtx);
+    }
+    idle_cv.notify_all();
+}
+
+/**
+ * @brief Pops a histogram pair from the free list, or allocates a new one.
+ */
+WorkerPool::WorkerHistograms* WorkerPool::acquire_histograms()
+{
+    std::lock_guard<std::mutex> lock(stats_mtx);
+    if (!free_histograms.empty())
+    {
+        WorkerHistograms* slot = free_histograms.back();
+        free_histograms.pop_back();
+        return slot;
+    }
+
+    histograms.emplace_back(new WorkerHistograms());
+    return histograms.back().get();
+}
+
+/**
+ * @brief Makes `slot` available to the next spawned worker; its samples are kept.
+ */
+void WorkerPool::release_histograms(WorkerHistograms* slot)
+{
+    std::lock_guard<std::mutex> lock(stats_mtx);
+    free_histograms.push_back(slot);
+}
+
 /*****************************************************************************/
\ No newline at end of file
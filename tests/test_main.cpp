@@ -19,15 +19,33 @@
 
 /* Standard libraries */
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <thread>
 #include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
 /* Project libraries */
 
+#include "cpu_affinity.h"
+#include "latency_histogram.h"
+#include "logger.h"
+#include "parallel_algorithms.h"
+#include "strand.h"
+#include "task.h"
+#include "task_graph.h"
 #include "thread_safe_queue.h"
+#include "work_stealing_deque.h"
 #include "worker_pool.h"
 
 /*****************************************************************************/
@@ -82,13 +100,12 @@ TEST(ThreadSafeQueue, GracefulClose) {
  * THEN all of them must be executed before stop().
  */
 TEST(WorkerPool, ExecutesAllTasks) {
-    ThreadSafeQueue<std::function<void()>> queue;
+    ThreadSafeQueue<Task> queue;
     WorkerPool pool(queue);
     std::atomic<int> counter{0};
 
     pool.start(3);
     for (int i = 0; i < 10; ++i) pool.submit([&] { ++counter; });
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
     pool.stop();
 
     EXPECT_EQ(counter, 10);
@@ -103,7 +120,7 @@ TEST(WorkerPool, ExecutesAllTasks) {
  */
 class WorkerPoolParamTest : public ::testing::TestWithParam<int> {
    protected:
-    ThreadSafeQueue<std::function<void()>> queue;
+    ThreadSafeQueue<Task> queue;
     std::atomic<int> counter{0};
 
     void SetUp() override { counter = 0; }
@@ -131,7 +148,9 @@ TEST_P(WorkerPoolParamTest, ExecutesAllTasksWithDifferentWorkerCounts) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         });
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    pool.wait_idle();
+    EXPECT_EQ(counter, total_tasks) << "wait_idle() returned early with " << num_workers
+                                    << " workers";
     pool.stop();
 
     EXPECT_EQ(counter, total_tasks) << "Failed with " << num_workers << " workers";
@@ -200,4 +219,2365 @@ TEST(ThreadSafeQueue, TryPopConcurrentReaders) {
 
     EXPECT_EQ(count.load(), max)
         << "All the values must be retrieved only once until the queue is empty";
-}
\ No newline at end of file
+}
+
+/**
+ * @test ThreadSafeQueue.TryPushRespectsCapacity
+ * @brief Validate that a bounded queue rejects non-blocking pushes when full.
+ *
+ * @details
+ * GIVEN a ThreadSafeQueue with capacity 2 holding two elements
+ * WHEN try_push() and push_for() are called
+ * THEN both must fail without modifying the queue, and succeed again once a slot is freed.
+ */
+TEST(ThreadSafeQueue, TryPushRespectsCapacity) {
+    ThreadSafeQueue<int> q(2);
+    EXPECT_EQ(q.capacity(), 2u);
+
+    EXPECT_TRUE(q.try_push(1));
+    EXPECT_TRUE(q.try_push(2));
+    EXPECT_FALSE(q.try_push(3)) << "try_push() must fail on a full queue";
+    EXPECT_FALSE(q.push_for(3, std::chrono::milliseconds(20)))
+        << "push_for() must time out on a full queue";
+    EXPECT_EQ(q.size(), 2u);
+
+    int val = 0;
+    ASSERT_TRUE(q.pop(val));
+    EXPECT_EQ(val, 1);
+    EXPECT_TRUE(q.try_push(3)) << "try_push() must succeed once a slot is freed";
+}
+
+/**
+ * @test ThreadSafeQueue.PushBlocksUntilSpace
+ * @brief Ensure push() applies backpressure on a full bounded queue.
+ *
+ * @details
+ * GIVEN a full ThreadSafeQueue with capacity 1
+ * WHEN a producer calls push() and a consumer later pops an element
+ * THEN the producer must stay blocked until the pop, then complete in FIFO order.
+ */
+TEST(ThreadSafeQueue, PushBlocksUntilSpace) {
+    ThreadSafeQueue<int> q(1);
+    std::atomic<bool> pushed{false};
+    q.push(1);
+
+    std::thread producer([&]() {
+        q.push(2);
+        pushed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(pushed) << "push() must block while the queue is full";
+
+    int val = 0;
+    ASSERT_TRUE(q.pop(val));
+    EXPECT_EQ(val, 1);
+    producer.join();
+
+    EXPECT_TRUE(pushed);
+    ASSERT_TRUE(q.pop(val));
+    EXPECT_EQ(val, 2);
+}
+
+/**
+ * @test ThreadSafeQueue.CloseReleasesBlockedProducer
+ * @brief Ensure close() unblocks producers waiting for free space.
+ *
+ * @details
+ * GIVEN a producer blocked in push() on a full bounded queue
+ * WHEN close() is called
+ * THEN push() must return false and later pushes must be rejected.
+ */
+TEST(ThreadSafeQueue, CloseReleasesBlockedProducer) {
+    ThreadSafeQueue<int> q(1);
+    q.push(1);
+
+    bool result = true;
+    std::thread producer([&]() { result = q.push(2); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    q.close();
+    producer.join();
+
+    EXPECT_FALSE(result) << "push() must fail once the queue is closed";
+    EXPECT_FALSE(q.try_push(3));
+    EXPECT_EQ(q.size(), 1u);
+}
+
+/**
+ * @test MpmcRingQueue.RoundsCapacityAndKeepsFifoOrder
+ * @brief Validate the lock-free ring backend in a single-thread context.
+ *
+ * @details
+ * GIVEN a ThreadSafeQueue<int, MpmcRingBackend> created with capacity 3
+ * WHEN it is filled, drained and refilled across the wrap-around point
+ * THEN the capacity must be rounded to 4, try_push() must fail when full and
+ * elements must be returned in FIFO order.
+ */
+TEST(MpmcRingQueue, RoundsCapacityAndKeepsFifoOrder) {
+    ThreadSafeQueue<int, MpmcRingBackend> q(3);
+    EXPECT_EQ(q.capacity(), 4u);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(round * 10 + i));
+        EXPECT_FALSE(q.try_push(99)) << "try_push() must fail on a full ring";
+        EXPECT_EQ(q.size(), 4u);
+
+        for (int i = 0; i < 4; ++i) {
+            int val = -1;
+            ASSERT_TRUE(q.pop(val));
+            EXPECT_EQ(val, round * 10 + i);
+        }
+        EXPECT_TRUE(q.empty());
+    }
+    EXPECT_FALSE(q.try_pop().has_value());
+}
+
+/**
+ * @test MpmcRingQueue.ConcurrentProducersConsumers
+ * @brief Stress the ring with several producers and consumers.
+ *
+ * @details
+ * GIVEN a small ring shared by 4 producers and 4 consumers
+ * WHEN every producer pushes 10000 values and the queue is closed afterwards
+ * THEN every value must be consumed exactly once (checked via count and sum).
+ */
+TEST(MpmcRingQueue, ConcurrentProducersConsumers) {
+    ThreadSafeQueue<int, MpmcRingBackend> q(64);
+    const int per_producer = 10000;
+    const int producers = 4;
+    const int consumers = 4;
+    std::atomic<long long> sum{0};
+    std::atomic<int> count{0};
+
+    std::vector<std::thread> threads;
+    for (int c = 0; c < consumers; ++c)
+        threads.emplace_back([&]() {
+            int val;
+            while (q.pop(val)) {
+                sum += val;
+                ++count;
+            }
+        });
+
+    std::vector<std::thread> prods;
+    for (int p = 0; p < producers; ++p)
+        prods.emplace_back([&]() {
+            for (int i = 1; i <= per_producer; ++i) q.push(std::move(i));
+        });
+    for (auto& t : prods) t.join();
+
+    while (!q.empty()) std::this_thread::yield();
+    q.close();
+    for (auto& t : threads) t.join();
+
+    EXPECT_EQ(count.load(), producers * per_producer);
+    EXPECT_EQ(sum.load(), producers * (static_cast<long long>(per_producer) * (per_producer + 1) / 2));
+}
+
+/**
+ * @test MpmcRingQueue.PassesOnWakeUpsSpentOnAnUnwrittenSlot
+ * @brief Check that no parked consumer is left asleep next to a published element.
+ *
+ * @details
+ * GIVEN two consumers parked on an empty ring
+ * WHEN a slow producer claims slot 0 and is still moving its element in while a second
+ *      producer publishes slot 1 (its wake-up finds slot 0 unreadable and is spent)
+ * THEN once slot 0 is written, both elements must still reach a consumer.
+ */
+TEST(MpmcRingQueue, PassesOnWakeUpsSpentOnAnUnwrittenSlot) {
+    struct SlowMove
+    {
+        int value;
+        bool slow;
+
+        SlowMove(int v, bool s) : value(v), slow(s) {}
+        SlowMove(SlowMove&& other) noexcept : value(other.value), slow(false) {
+            if (other.slow) std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        SlowMove& operator=(SlowMove&&) noexcept = default;
+    };
+
+    ThreadSafeQueue<SlowMove, MpmcRingBackend> q(8);
+    std::atomic<int> taken{0};
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 2; ++c)
+        consumers.emplace_back([&]() {
+            SlowMove item(0, false);
+            if (q.pop(item)) ++taken;
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    std::thread slow_producer([&]() { q.push(SlowMove(1, true)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    q.push(SlowMove(2, false));
+    slow_producer.join();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (taken.load() < 2 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(taken.load(), 2) << "a consumer stayed parked while an element was queued";
+
+    q.close();
+    for (auto& t : consumers) t.join();
+}
+
+/**
+ * @test WorkerPool.RunsOnLockFreeBackend
+ * @brief Ensure WorkerPool works unchanged on top of the lock-free backend.
+ *
+ * @details
+ * GIVEN a WorkerPool bound to a ThreadSafeQueue<Task, MpmcRingBackend>
+ * WHEN 100 tasks are submitted
+ * THEN all of them must be executed before stop().
+ */
+TEST(WorkerPool, RunsOnLockFreeBackend) {
+    ThreadSafeQueue<Task, MpmcRingBackend> queue;
+    WorkerPool pool(queue);
+    std::atomic<int> counter{0};
+
+    pool.start(4);
+    for (int i = 0; i < 100; ++i) pool.submit([&] { ++counter; });
+    pool.stop();
+
+    EXPECT_EQ(counter, 100);
+}
+
+/**
+ * @test SpscRingQueue.SingleProducerSingleConsumerOrder
+ * @brief Validate FIFO ordering of the SPSC backend across threads.
+ *
+ * @details
+ * GIVEN a ThreadSafeQueue<int, SpscRingBackend> with a small capacity
+ * WHEN one producer pushes 100000 increasing values and one consumer pops them
+ * THEN the consumer must observe every value exactly once and in order,
+ * and pop() must return false after close() once the ring is drained.
+ */
+TEST(SpscRingQueue, SingleProducerSingleConsumerOrder) {
+    ThreadSafeQueue<int, SpscRingBackend> q(16);
+    EXPECT_EQ(q.capacity(), 16u);
+    const int total = 100000;
+    bool in_order = true;
+    int received = 0;
+
+    std::thread consumer([&]() {
+        int val;
+        while (q.pop(val)) {
+            if (val != received) in_order = false;
+            ++received;
+        }
+    });
+
+    for (int i = 0; i < total; ++i) q.push(std::move(i));
+    while (!q.empty()) std::this_thread::yield();
+    q.close();
+    consumer.join();
+
+    EXPECT_TRUE(in_order) << "Values must be received in FIFO order";
+    EXPECT_EQ(received, total);
+}
+
+/**
+ * @test SpscRingQueue.TryOperationsRespectCapacity
+ * @brief Validate the non-blocking SPSC operations on a full and empty ring.
+ *
+ * @details
+ * GIVEN an SPSC ring of capacity 2
+ * WHEN it is filled and drained with try_push() / try_pop()
+ * THEN try_push() must fail when full, try_pop() must return nullopt when empty,
+ * and push_for() must time out on a full ring.
+ */
+TEST(SpscRingQueue, TryOperationsRespectCapacity) {
+    ThreadSafeQueue<int, SpscRingBackend> q(2);
+
+    EXPECT_FALSE(q.try_pop().has_value());
+    EXPECT_TRUE(q.try_push(1));
+    EXPECT_TRUE(q.try_push(2));
+    EXPECT_FALSE(q.try_push(3));
+    EXPECT_FALSE(q.push_for(3, std::chrono::milliseconds(10)));
+    EXPECT_EQ(q.size(), 2u);
+
+    auto val = q.try_pop();
+    ASSERT_TRUE(val.has_value());
+    EXPECT_EQ(val.value(), 1);
+    EXPECT_TRUE(q.try_push(3));
+}
+
+/**
+ * @test SpscRingQueue.PingPongNeverLosesAWakeUp
+ * @brief Validate the parking handshake of the SPSC backend.
+ *
+ * @details
+ * GIVEN two SPSC rings connecting two threads, so each side parks on every round
+ * WHEN 20000 values are bounced back and forth with blocking push() / pop()
+ * THEN every round trip must complete: parked threads are only woken by notifications
+ *      (there is no timed re-check), so a single lost wake-up would hang the test.
+ */
+TEST(SpscRingQueue, PingPongNeverLosesAWakeUp) {
+    ThreadSafeQueue<int, SpscRingBackend> ping(2);
+    ThreadSafeQueue<int, SpscRingBackend> pong(2);
+    constexpr int rounds = 20000;
+
+    std::thread echo([&] {
+        int value = 0;
+        while (ping.pop(value)) pong.push(value + 1);
+    });
+
+    int value = 0;
+    for (int i = 0; i < rounds; ++i) {
+        if (!ping.push(std::move(value)) || !pong.pop(value)) break;
+    }
+    ping.close();
+    echo.join();
+    EXPECT_EQ(value, rounds);
+}
+
+/**
+ * @test ThreadSafeQueue.BulkPushPopKeepsOrder
+ * @brief Validate push_bulk(), pop_bulk() and try_pop_bulk() on the mutex backend.
+ *
+ * @details
+ * GIVEN a ThreadSafeQueue and a vector of 10 values
+ * WHEN the vector is pushed with push_bulk() and drained in batches of 4
+ * THEN batches must contain 4, 4 and 2 elements in FIFO order, and
+ * try_pop_bulk() must return 0 on the empty queue.
+ */
+TEST(ThreadSafeQueue, BulkPushPopKeepsOrder) {
+    ThreadSafeQueue<int> q;
+    std::vector<int> input;
+    for (int i = 0; i < 10; ++i) input.push_back(i);
+
+    EXPECT_EQ(q.push_bulk(input.begin(), input.end()), 10u);
+    EXPECT_EQ(q.size(), 10u);
+
+    std::vector<int> output;
+    EXPECT_EQ(q.pop_bulk(std::back_inserter(output), 4), 4u);
+    EXPECT_EQ(q.try_pop_bulk(std::back_inserter(output), 4), 4u);
+    EXPECT_EQ(q.pop_bulk(std::back_inserter(output), 4), 2u);
+    EXPECT_EQ(output, input);
+
+    EXPECT_EQ(q.try_pop_bulk(std::back_inserter(output), 4), 0u);
+}
+
+/**
+ * @test ThreadSafeQueue.BulkPushWakesWaitingConsumers
+ * @brief Ensure a single push_bulk() wakes every consumer that can be served.
+ *
+ * @details
+ * GIVEN 3 consumers blocked in pop()
+ * WHEN 3 elements are pushed with one push_bulk() call
+ * THEN all consumers must return with one element each.
+ */
+TEST(ThreadSafeQueue, BulkPushWakesWaitingConsumers) {
+    ThreadSafeQueue<int> q;
+    std::atomic<int> received{0};
+
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 3; ++i)
+        consumers.emplace_back([&]() {
+            int val;
+            if (q.pop(val)) ++received;
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::vector<int> input{1, 2, 3};
+    q.push_bulk(input.begin(), input.end());
+    for (auto& t : consumers) t.join();
+
+    EXPECT_EQ(received.load(), 3);
+}
+
+/**
+ * @brief Pushes 1000 elements through a bounded queue in one push_bulk() call
+ *        while a consumer drains it with pop_bulk(), and checks the delivered order.
+ */
+template <typename Queue>
+static void ExpectBoundedBulkTransfer(Queue& q) {
+    const int total = 1000;
+    std::vector<int> input;
+    for (int i = 0; i < total; ++i) input.push_back(i);
+
+    std::vector<int> output;
+    std::thread consumer([&]() {
+        while (static_cast<int>(output.size()) < total)
+            q.pop_bulk(std::back_inserter(output), 3);
+    });
+
+    EXPECT_EQ(q.push_bulk(input.begin(), input.end()), static_cast<std::size_t>(total));
+    consumer.join();
+    EXPECT_EQ(output, input);
+}
+
+/**
+ * @test ThreadSafeQueue.BulkPushOnBoundedQueue
+ * @brief Validate that push_bulk() applies backpressure in chunks.
+ *
+ * @details
+ * GIVEN a bounded queue (capacity 4) on each backend and a consumer draining with pop_bulk()
+ * WHEN 1000 elements are pushed with a single push_bulk() call
+ * THEN every element must be delivered in order.
+ */
+TEST(ThreadSafeQueue, BulkPushOnBoundedQueue) {
+    ThreadSafeQueue<int> mutex_queue(4);
+    ExpectBoundedBulkTransfer(mutex_queue);
+
+    ThreadSafeQueue<int, MpmcRingBackend> mpmc_queue(4);
+    ExpectBoundedBulkTransfer(mpmc_queue);
+
+    ThreadSafeQueue<int, SpscRingBackend> spsc_queue(4);
+    ExpectBoundedBulkTransfer(spsc_queue);
+}
+
+/**
+ * @brief Tracing policy that counts queue diagnostics instead of printing them.
+ */
+struct CountingQueueTrace {
+    static std::atomic<int> events;
+    static void trace(const char*) { ++events; }
+};
+std::atomic<int> CountingQueueTrace::events{0};
+
+/**
+ * @test ThreadSafeQueue.TracePolicyReceivesDiagnostics
+ * @brief Ensure queue diagnostics are routed through the Trace template parameter.
+ *
+ * @details
+ * GIVEN a ThreadSafeQueue using a counting tracing policy
+ * WHEN elements are popped, try_pop() misses, and the queue is closed
+ * THEN each diagnostic must reach the policy, while the default NoQueueTrace
+ * queue keeps working without emitting anything.
+ */
+TEST(ThreadSafeQueue, TracePolicyReceivesDiagnostics) {
+    CountingQueueTrace::events = 0;
+    ThreadSafeQueue<int, MutexBackend, CountingQueueTrace> q;
+
+    q.push(1);
+    int val = 0;
+    ASSERT_TRUE(q.pop(val));
+    EXPECT_EQ(CountingQueueTrace::events.load(), 1) << "pop() must trace the extraction";
+
+    EXPECT_FALSE(q.try_pop().has_value());
+    EXPECT_EQ(CountingQueueTrace::events.load(), 2) << "try_pop() must trace the miss";
+
+    q.close();
+    EXPECT_EQ(CountingQueueTrace::events.load(), 3) << "close() must be traced";
+
+    ThreadSafeQueue<int, MutexBackend, VerboseQueueTrace> verbose;
+    verbose.push(7);
+    ASSERT_TRUE(verbose.pop(val));
+    EXPECT_EQ(val, 7);
+}
+
+/**
+ * @test Task.SmallCallablesAreStoredInline
+ * @brief Verify the small-buffer optimization and move-only semantics of Task.
+ *
+ * @details
+ * GIVEN a lambda capturing a std::unique_ptr and a lambda capturing a large array
+ * WHEN both are wrapped in a Task and moved around
+ * THEN the small one must live inline, the large one on the heap,
+ * both must run correctly, and moved-from tasks must be empty.
+ */
+TEST(Task, SmallCallablesAreStoredInline) {
+    int hits = 0;
+    std::unique_ptr<int> value(new int(5));
+    Task small([&hits, value = std::move(value)] { hits += *value; });
+    EXPECT_TRUE(small.is_inline());
+
+    Task moved(std::move(small));
+    EXPECT_FALSE(static_cast<bool>(small));
+    ASSERT_TRUE(static_cast<bool>(moved));
+    moved();
+    EXPECT_EQ(hits, 5);
+
+    char big[TASK_INLINE_SIZE * 2] = {1};
+    Task large([&hits, big] { hits += big[0]; });
+    EXPECT_FALSE(large.is_inline());
+
+    moved = std::move(large);
+    EXPECT_FALSE(static_cast<bool>(large));
+    moved();
+    EXPECT_EQ(hits, 6);
+
+    Task empty;
+    EXPECT_THROW(empty(), std::bad_function_call);
+}
+
+/**
+ * @test Task.NullCallablesGiveEmptyTasks
+ * @brief Verify that null callables are stored as empty tasks and non-callables rejected.
+ *
+ * @details
+ * GIVEN an empty std::function, a null function pointer and a captureless lambda
+ * WHEN each is wrapped in a Task
+ * THEN the null ones must give empty tasks that throw bad_function_call, the lambda
+ *      must run, and a non-callable type must not convert to Task at all.
+ */
+TEST(Task, NullCallablesGiveEmptyTasks) {
+    Task from_function{std::function<void()>()};
+    EXPECT_FALSE(static_cast<bool>(from_function));
+    EXPECT_THROW(from_function(), std::bad_function_call);
+
+    void (*null_pointer)() = nullptr;
+    Task from_pointer(null_pointer);
+    EXPECT_FALSE(static_cast<bool>(from_pointer));
+
+    int hits = 0;
+    Task from_lambda([&hits] { ++hits; });
+    Task captureless([] {});
+    ASSERT_TRUE(static_cast<bool>(from_lambda));
+    EXPECT_TRUE(static_cast<bool>(captureless));
+    from_lambda();
+    EXPECT_EQ(hits, 1);
+
+    static_assert(!std::is_constructible<Task, int>::value, "int is not callable");
+    static_assert(!std::is_convertible<std::string, Task>::value, "string is not callable");
+}
+
+/**
+ * @test WorkerPool.RunsMoveOnlyTasks
+ * @brief Ensure the pool accepts tasks that capture move-only state.
+ *
+ * @details
+ * GIVEN a running WorkerPool
+ * WHEN 100 tasks each owning a std::unique_ptr are submitted
+ * THEN every task must run with its own captured value before stop() returns.
+ */
+TEST(WorkerPool, RunsMoveOnlyTasks) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    std::atomic<int> sum{0};
+
+    pool.start(4);
+    for (int i = 1; i <= 100; ++i) {
+        std::unique_ptr<int> value(new int(i));
+        pool.submit([&sum, value = std::move(value)] { sum += *value; });
+    }
+    pool.stop();
+
+    EXPECT_EQ(sum.load(), 5050);
+}
+
+/**
+ * @test WorkerPool.SubmitReturnsFutureResults
+ * @brief Verify that submit(f, args...) delivers results and exceptions through TaskFuture.
+ *
+ * @details
+ * GIVEN a running WorkerPool
+ * WHEN value-returning, argument-binding, void and throwing tasks are submitted
+ * THEN get() must return each result, complete the void task,
+ * and rethrow the exception raised inside the worker.
+ */
+TEST(WorkerPool, SubmitReturnsFutureResults) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    std::vector<TaskFuture<int>> squares;
+    for (int i = 0; i < 10; ++i) squares.push_back(pool.submit([](int x) { return x * x; }, i));
+
+    std::unique_ptr<int> owned(new int(3));
+    TaskFuture<std::string> text =
+        pool.submit([](std::unique_ptr<int> p, std::string s) { return s + std::to_string(*p); },
+                    std::move(owned), std::string("n="));
+
+    std::atomic<bool> ran{false};
+    TaskFuture<void> done = pool.submit([&ran] { ran = true; });
+
+    TaskFuture<int> failing = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+
+    for (int i = 0; i < 10; ++i) EXPECT_EQ(squares[i].get(), i * i);
+    EXPECT_FALSE(squares[0].valid()) << "get() must release the shared state";
+    EXPECT_EQ(text.get(), "n=3");
+    done.get();
+    EXPECT_TRUE(ran.load());
+    EXPECT_THROW(failing.get(), std::runtime_error);
+
+    pool.stop();
+}
+
+/**
+ * @test WorkerPool.FutureReportsDroppedTask
+ * @brief Ensure a task rejected by a closed queue does not leave its future hanging.
+ *
+ * @details
+ * GIVEN a WorkerPool whose queue has been closed
+ * WHEN a value-returning task is submitted
+ * THEN the future must be ready and get() must throw std::future_error
+ * (broken_promise), while wait_for() on a pending future reports a timeout.
+ */
+TEST(WorkerPool, FutureReportsDroppedTask) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+
+    TaskFuture<int> pending = pool.submit([] { return 1; });
+    EXPECT_EQ(pending.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+
+    queue.close();
+    TaskFuture<int> dropped = pool.submit([] { return 2; });
+    ASSERT_TRUE(dropped.is_ready());
+    EXPECT_THROW(dropped.get(), std::future_error);
+
+    queue.clear();
+    EXPECT_THROW(pending.get(), std::future_error);
+}
+
+/**
+ * @test WorkStealingDeque.OwnerLifoThiefFifo
+ * @brief Validate the ends of the Chase-Lev deque and buffer growth.
+ *
+ * @details
+ * GIVEN a WorkStealingDeque with a tiny initial capacity
+ * WHEN the owner pushes more elements than fit in the initial buffer
+ * THEN steal() must return the oldest elements, pop() the newest ones,
+ * and both must report empty once everything has been taken.
+ */
+TEST(WorkStealingDeque, OwnerLifoThiefFifo) {
+    WorkStealingDeque<int> deque(2);
+    for (int i = 0; i < 10; ++i) deque.push(i);
+    EXPECT_EQ(deque.size(), 10u);
+
+    EXPECT_EQ(*deque.steal(), 0);
+    EXPECT_EQ(*deque.steal(), 1);
+    EXPECT_EQ(*deque.pop(), 9);
+    EXPECT_EQ(*deque.pop(), 8);
+
+    int remaining = 0;
+    while (deque.pop()) ++remaining;
+    EXPECT_EQ(remaining, 6);
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.steal().has_value());
+    EXPECT_FALSE(deque.pop().has_value());
+}
+
+/**
+ * @test WorkStealingDeque.ConcurrentStealsTakeEachItemOnce
+ * @brief Stress the owner/thief race on the last elements.
+ *
+ * @details
+ * GIVEN one owner thread pushing and popping and three thief threads stealing
+ * WHEN 100000 distinct values flow through the deque
+ * THEN every value must be taken exactly once.
+ */
+TEST(WorkStealingDeque, ConcurrentStealsTakeEachItemOnce) {
+    const int total = 100000;
+    WorkStealingDeque<int> deque(4);
+    std::vector<std::atomic<int>> taken(total);
+    for (auto& t : taken) t = 0;
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            while (!done || !deque.empty()) {
+                if (nonstd::optional<int> v = deque.steal()) ++taken[*v];
+            }
+        });
+    }
+
+    for (int i = 0; i < total; ++i) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            if (nonstd::optional<int> v = deque.pop()) ++taken[*v];
+        }
+    }
+    while (nonstd::optional<int> v = deque.pop()) ++taken[*v];
+    done = true;
+    for (auto& t : thieves) t.join();
+
+    int wrong = 0;
+    for (auto& t : taken) wrong += (t.load() != 1);
+    EXPECT_EQ(wrong, 0);
+}
+
+/**
+ * @test WorkerPool.WorkStealingRunsRecursiveTasks
+ * @brief Ensure the work-stealing mode runs nested submissions and drains on stop().
+ *
+ * @details
+ * GIVEN a WorkerPool in SchedulingMode::WorkStealing with 4 workers
+ * WHEN external tasks recursively submit children from inside the workers
+ * THEN every task in the tree must run and stop() must return only after the
+ * locally spawned tasks have been drained.
+ */
+TEST(WorkerPool, WorkStealingRunsRecursiveTasks) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue, WorkerPool::SchedulingMode::WorkStealing);
+    std::atomic<int> leaves{0};
+
+    std::function<void(int)> spawn = [&](int depth) {
+        if (depth == 0) {
+            ++leaves;
+            return;
+        }
+        pool.submit(Task([&spawn, depth] { spawn(depth - 1); }));
+        pool.submit(Task([&spawn, depth] { spawn(depth - 1); }));
+    };
+
+    pool.start(4);
+    std::vector<TaskFuture<int>> roots;
+    for (int i = 0; i < 8; ++i) {
+        roots.push_back(pool.submit([&spawn] {
+            spawn(8);
+            return 1;
+        }));
+    }
+    for (auto& root : roots) EXPECT_EQ(root.get(), 1);
+    pool.stop();
+
+    EXPECT_EQ(leaves.load(), 8 * 256);
+}
+
+/**
+ * @test WorkerPool.WaitIdleBlocksUntilTasksFinish
+ * @brief Verify the completion barrier and its timed variant.
+ *
+ * @details
+ * GIVEN a running pool with a task blocked on a flag
+ * WHEN wait_idle_for() is called before and after releasing the flag
+ * THEN it must time out while the task runs, and wait_idle() must return only
+ * after every submitted task (including the blocked one) has completed.
+ */
+TEST(WorkerPool, WaitIdleBlocksUntilTasksFinish) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    std::atomic<bool> release{false};
+    std::atomic<int> counter{0};
+
+    pool.start(2);
+    EXPECT_TRUE(pool.wait_idle_for(std::chrono::milliseconds(0))) << "fresh pool must be idle";
+
+    pool.submit([&] {
+        while (!release) std::this_thread::yield();
+        ++counter;
+    });
+    for (int i = 0; i < 50; ++i) pool.submit([&] { ++counter; });
+
+    EXPECT_FALSE(pool.wait_idle_for(std::chrono::milliseconds(20)));
+    release = true;
+    pool.wait_idle();
+    EXPECT_EQ(counter.load(), 51);
+
+    pool.submit([&] { ++counter; });
+    pool.stop();
+    EXPECT_EQ(counter.load(), 52) << "stop() must drain work submitted after wait_idle()";
+}
+
+/**
+ * @brief Polls `condition` every millisecond for up to `timeout`.
+ */
+template <typename Condition>
+static bool EventuallyTrue(Condition condition, std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/**
+ * @test WorkerPool.ElasticGrowsUnderBacklogAndShrinksWhenIdle
+ * @brief Verify elastic sizing between min_workers and max_workers.
+ *
+ * @details
+ * GIVEN an elastic pool with 1 to 4 workers, a backlog threshold of 2 and a 50 ms
+ * idle timeout
+ * WHEN 8 blocking tasks are submitted and later released
+ * THEN the pool must grow to 4 workers, run every task, and shrink back to 1 worker
+ * once the extra workers have been idle for the timeout.
+ */
+TEST(WorkerPool, ElasticGrowsUnderBacklogAndShrinksWhenIdle) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    WorkerPool::ElasticConfig config;
+    config.min_workers   = 1;
+    config.max_workers   = 4;
+    config.spawn_backlog = 2;
+    config.spawn_wait    = std::chrono::milliseconds(1000);
+    config.idle_timeout  = std::chrono::milliseconds(50);
+
+    pool.start_elastic(config);
+    EXPECT_EQ(pool.worker_count(), 1u);
+
+    std::atomic<bool> release{false};
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 8; ++i) {
+        pool.submit([&] {
+            while (!release) std::this_thread::yield();
+            ++counter;
+        });
+    }
+
+    EXPECT_TRUE(EventuallyTrue([&] { return pool.worker_count() == 4u; },
+                               std::chrono::milliseconds(2000)));
+    release = true;
+    pool.wait_idle();
+    EXPECT_EQ(counter.load(), 8);
+
+    EXPECT_TRUE(EventuallyTrue([&] { return pool.worker_count() == 1u; },
+                               std::chrono::milliseconds(2000)))
+        << "idle workers must retire down to min_workers";
+
+    pool.submit([&] { ++counter; });
+    pool.stop();
+    EXPECT_EQ(counter.load(), 9);
+    EXPECT_EQ(pool.worker_count(), 0u);
+}
+
+/**
+ * @test WorkerPool.ElasticSpawnsWhenTasksWaitTooLong
+ * @brief Ensure the wait-time trigger adds a worker even for a shallow backlog.
+ *
+ * @details
+ * GIVEN an elastic pool with one busy worker and a backlog threshold that is never reached
+ * WHEN a task waits longer than spawn_wait and another task is submitted
+ * THEN a second worker must be spawned and run the waiting tasks.
+ */
+TEST(WorkerPool, ElasticSpawnsWhenTasksWaitTooLong) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    WorkerPool::ElasticConfig config;
+    config.min_workers   = 1;
+    config.max_workers   = 2;
+    config.spawn_backlog = 100;
+    config.spawn_wait    = std::chrono::milliseconds(5);
+
+    pool.start_elastic(config);
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    std::atomic<int> counter{0};
+    pool.submit([&] {
+        started = true;
+        while (!release) std::this_thread::yield();
+    });
+    ASSERT_TRUE(EventuallyTrue([&] { return started.load(); }, std::chrono::milliseconds(1000)));
+
+    pool.submit([&] { ++counter; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pool.submit([&] { ++counter; });
+
+    EXPECT_TRUE(EventuallyTrue([&] { return counter.load() == 2; },
+                               std::chrono::milliseconds(2000)))
+        << "a second worker must pick up the waiting tasks";
+    EXPECT_EQ(pool.worker_count(), 2u);
+
+    release = true;
+    pool.stop();
+}
+
+/**
+ * @test CpuAffinity.CompactAndScatterOrdering
+ * @brief Validate CPU ordering on a synthetic 2-package, 2-core, 2-thread topology.
+ *
+ * @details
+ * GIVEN CPUs 0-7 where CPU n sits on package n / 4, core (n / 2) % 2
+ * WHEN they are ordered with AffinityMode::Compact and AffinityMode::Scatter
+ * THEN compact must fill SMT siblings and cores of package 0 first, while scatter
+ * must visit one hardware thread per core, alternating packages, before siblings.
+ */
+TEST(CpuAffinity, CompactAndScatterOrdering) {
+    std::vector<CpuTopology> cpus;
+    for (int cpu = 7; cpu >= 0; --cpu) cpus.push_back({cpu, cpu / 4, (cpu / 2) % 2});
+
+    EXPECT_EQ(CpuAffinity::order(AffinityMode::Compact, cpus),
+              (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(CpuAffinity::order(AffinityMode::Scatter, cpus),
+              (std::vector<int>{0, 4, 2, 6, 1, 5, 3, 7}));
+}
+
+/**
+ * @test WorkerPool.PinsWorkersToCpuList
+ * @brief Ensure workers are pinned according to the policy and the mapping is exposed.
+ *
+ * @details
+ * GIVEN a pool configured with an explicit CPU list containing the first allowed CPU
+ * (plus an id outside the process cpuset, which must be ignored)
+ * WHEN 3 workers are started
+ * THEN affinity_map() must report that CPU for every worker, and tasks must observe
+ * it as their only allowed CPU; after stop() the mapping must be empty.
+ */
+TEST(WorkerPool, PinsWorkersToCpuList) {
+    const std::vector<int> allowed = CpuAffinity::allowed_cpus();
+    ASSERT_FALSE(allowed.empty());
+
+    AffinityPolicy policy;
+    policy.mode = AffinityMode::CpuList;
+    policy.cpus = {allowed.front(), 100000};
+    ASSERT_EQ(CpuAffinity::plan(policy).size(), 1u);
+
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.set_affinity(policy);
+    pool.start(3);
+
+    auto mapping = pool.affinity_map();
+    ASSERT_EQ(mapping.size(), 3u);
+    for (const auto& entry : mapping) EXPECT_EQ(entry.second, std::vector<int>{allowed.front()});
+
+#ifdef __linux__
+    std::vector<TaskFuture<std::vector<int>>> observed;
+    for (int i = 0; i < 6; ++i)
+        observed.push_back(pool.submit([] { return CpuAffinity::allowed_cpus(); }));
+    for (auto& f : observed) EXPECT_EQ(f.get(), std::vector<int>{allowed.front()});
+#endif
+
+    pool.stop();
+    EXPECT_TRUE(pool.affinity_map().empty());
+}
+
+/**
+ * @brief Counts the lines of `text` that contain `marker`.
+ */
+static std::size_t CountLinesWith(const std::string& text, const std::string& marker) {
+    std::istringstream in(text);
+    std::string        line;
+    std::size_t        count = 0;
+    while (std::getline(in, line))
+        if (line.find(marker) != std::string::npos) ++count;
+    return count;
+}
+
+/**
+ * @test Logger.AsyncModeWritesEveryRecordOnFlush
+ * @brief Ensure the background writer prints every record logged by concurrent threads.
+ *
+ * @details
+ * GIVEN the logger in asynchronous mode with the BLOCK policy and a small ring
+ * WHEN 4 threads log 200 messages each and flush() is called
+ * THEN all 800 lines must be on stdout, correctly formatted, and nothing dropped.
+ */
+TEST(Logger, AsyncModeWritesEveryRecordOnFlush) {
+    testing::internal::CaptureStdout();
+    Logger::start_async(64, Logger::OverflowPolicy::BLOCK);
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t)
+        producers.emplace_back([] {
+            for (int i = 0; i < 200; ++i) Logger::info("async-record " + std::to_string(i));
+        });
+    for (auto& th : producers) th.join();
+    Logger::flush();
+
+    const std::string out = testing::internal::GetCapturedStdout();
+    Logger::stop_async();
+
+    EXPECT_EQ(CountLinesWith(out, "] [INFO] async-record "), 800u);
+    EXPECT_EQ(Logger::dropped_count(), 0u);
+}
+
+/**
+ * @test Logger.CountDropsPolicyReportsLostRecords
+ * @brief Ensure a full ring drops records under COUNT_DROPS and reports how many.
+ *
+ * @details
+ * GIVEN the logger in asynchronous mode with a 4-record ring and COUNT_DROPS
+ * WHEN 2000 messages are logged in a burst and the logger is stopped
+ * THEN written + dropped must equal 2000, some records must have been dropped and a
+ * warning with the drop count must have been written.
+ */
+TEST(Logger, CountDropsPolicyReportsLostRecords) {
+    testing::internal::CaptureStdout();
+    Logger::start_async(4, Logger::OverflowPolicy::COUNT_DROPS);
+    for (int i = 0; i < 2000; ++i) Logger::info("burst-record " + std::to_string(i));
+    Logger::stop_async();
+    const std::string out = testing::internal::GetCapturedStdout();
+
+    const std::size_t dropped = Logger::dropped_count();
+    EXPECT_GT(dropped, 0u);
+    EXPECT_EQ(CountLinesWith(out, "burst-record ") + dropped, 2000u);
+    EXPECT_GE(CountLinesWith(out, "[WARN] Logger dropped "), 1u);
+}
+
+/**
+ * @test Logger.TimestampPrecisionAddsSubSecondDigits
+ * @brief Ensure the cached timestamp gets the requested number of sub-second digits.
+ *
+ * @details
+ * GIVEN the logger in synchronous mode
+ * WHEN lines are logged with SECONDS, MILLISECONDS and MICROSECONDS precision
+ * THEN each line must carry a well-formed timestamp with 0, 3 and 6 fraction digits.
+ */
+TEST(Logger, TimestampPrecisionAddsSubSecondDigits) {
+    const std::string date_time = "\\[\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}";
+    const struct
+    {
+        Logger::TimestampPrecision precision;
+        std::string                fraction;
+    } cases[] = {{Logger::TimestampPrecision::SECONDS, ""},
+                 {Logger::TimestampPrecision::MILLISECONDS, "\\.\\d{3}"},
+                 {Logger::TimestampPrecision::MICROSECONDS, "\\.\\d{6}"}};
+
+    for (const auto& c : cases) {
+        Logger::set_timestamp_precision(c.precision);
+        testing::internal::CaptureStdout();
+        Logger::info("stamped");
+        Logger::info("stamped");
+        const std::string out = testing::internal::GetCapturedStdout();
+
+        const std::regex line(date_time + c.fraction + "\\] \\[INFO\\] stamped\n" + date_time +
+                              c.fraction + "\\] \\[INFO\\] stamped\n");
+        EXPECT_TRUE(std::regex_match(out, line)) << out;
+    }
+    Logger::set_timestamp_precision(Logger::TimestampPrecision::SECONDS);
+}
+
+/**
+ * @brief Streamable type counting how often it is converted to text.
+ */
+struct CountingArg
+{
+    int* conversions;
+};
+
+static std::ostream& operator<<(std::ostream& os, const CountingArg& arg) {
+    ++*arg.conversions;
+    return os << "counted";
+}
+
+/**
+ * @test Logger.FilteredMessagesAreNeverFormatted
+ * @brief Ensure arguments are only converted to text when the level is enabled.
+ *
+ * @details
+ * GIVEN minLevel == WARN
+ * WHEN info() and LOG_INFO() are called with an argument that counts conversions
+ * THEN nothing is printed, the argument is never converted and the LOG_INFO argument
+ * expression is not even evaluated; at INFO level the pieces are concatenated.
+ */
+TEST(Logger, FilteredMessagesAreNeverFormatted) {
+    int conversions = 0;
+    int evaluations = 0;
+    auto expensive  = [&evaluations] { return ++evaluations; };
+
+    Logger::set_min_level(Logger::Level::WARN);
+    EXPECT_FALSE(Logger::is_enabled(Logger::Level::INFO));
+    testing::internal::CaptureStdout();
+    Logger::info("filtered ", CountingArg{&conversions});
+    LOG_INFO("filtered ", expensive());
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+    EXPECT_EQ(conversions, 0);
+    EXPECT_EQ(evaluations, 0);
+
+    Logger::set_min_level(Logger::Level::INFO);
+    testing::internal::CaptureStdout();
+    Logger::info("pieces ", 42, ' ', 2.5, ' ', CountingArg{&conversions}, ' ', std::string("end"));
+    LOG_WARN("macro ", expensive());
+    const std::string out = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(CountLinesWith(out, "[INFO] pieces 42 2.500000 counted end"), 1u);
+    EXPECT_EQ(CountLinesWith(out, "[WARN] macro 1"), 1u);
+    EXPECT_EQ(conversions, 1);
+}
+
+/**
+ * @test Logger.CompileTimeMinimumLevelWins
+ * @brief Ensure levels below LOGGER_MIN_LEVEL stay disabled whatever the runtime level.
+ *
+ * @details
+ * GIVEN set_min_level(DBG)
+ * WHEN is_enabled(DBG) is queried
+ * THEN it must match whether DBG is compiled in (LOGGER_MIN_LEVEL == 0), while ERROR
+ * is always enabled.
+ */
+TEST(Logger, CompileTimeMinimumLevelWins) {
+    Logger::set_min_level(Logger::Level::DBG);
+    EXPECT_EQ(Logger::is_enabled(Logger::Level::DBG), LOGGER_MIN_LEVEL == 0);
+    EXPECT_TRUE(Logger::is_enabled(Logger::Level::ERROR));
+    Logger::set_min_level(Logger::Level::INFO);
+}
+
+/**
+ * @test LatencyHistogram.PercentilesStayWithinBucketPrecision
+ * @brief Ensure bucket bounds hold every value and percentiles are within ~3 %.
+ *
+ * @details
+ * GIVEN values 1..10000 ns recorded once each
+ * WHEN the summary is computed
+ * THEN p50/p99/p999 must be within 1/32 above the exact rank values, max must be exact,
+ * and every value must map to a bucket whose upper bound is not below it.
+ */
+TEST(LatencyHistogram, PercentilesStayWithinBucketPrecision) {
+    std::unique_ptr<LatencyHistogram> histogram(new LatencyHistogram());
+    for (std::int64_t v = 1; v <= 10000; ++v) {
+        const auto value = static_cast<std::uint64_t>(v);
+        const auto index = LatencyHistogram::bucket_index(value);
+        const auto upper = LatencyHistogram::bucket_upper_bound(index);
+        ASSERT_GE(upper, value);
+        ASSERT_LE(upper, value + value / 32);
+        histogram->record(std::chrono::nanoseconds(v));
+    }
+    EXPECT_EQ(LatencyHistogram::bucket_index(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+
+    const LatencySummary summary = histogram->summary();
+    EXPECT_EQ(summary.count, 10000u);
+    EXPECT_GE(summary.p50.count(), 5000);
+    EXPECT_LE(summary.p50.count(), 5000 + 5000 / 32);
+    EXPECT_GE(summary.p99.count(), 9900);
+    EXPECT_LE(summary.p99.count(), 10000);
+    EXPECT_GE(summary.p999.count(), 9990);
+    EXPECT_EQ(summary.max.count(), 10000);
+}
+
+/**
+ * @test WorkerPool.InstrumentationRecordsQueueWaitAndRunTime
+ * @brief Ensure stats() separates time spent queued from time spent running.
+ *
+ * @details
+ * GIVEN an instrumented single-worker pool
+ * WHEN a 20 ms task is followed by 10 empty tasks
+ * THEN 11 samples must be recorded, the longest run time must cover the slow task and
+ * the queued tasks must show at least that long a wait; once instrumentation is off,
+ * no more samples are added.
+ */
+TEST(WorkerPool, InstrumentationRecordsQueueWaitAndRunTime) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.set_instrumentation(true);
+    pool.start(1);
+
+    pool.submit(Task([] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }));
+    for (int i = 0; i < 10; ++i) pool.submit(Task([] {}));
+    pool.wait_idle();
+
+    WorkerPool::Stats stats = pool.stats();
+    EXPECT_EQ(stats.run_time.count, 11u);
+    EXPECT_EQ(stats.queue_wait.count, 11u);
+    EXPECT_GE(stats.run_time.max, std::chrono::milliseconds(20));
+    EXPECT_GE(stats.queue_wait.max, std::chrono::milliseconds(15));
+    EXPECT_LE(stats.run_time.p50, stats.run_time.max);
+
+    pool.set_instrumentation(false);
+    pool.submit(Task([] {}));
+    pool.wait_idle();
+    EXPECT_EQ(pool.stats().run_time.count, 11u);
+
+    pool.stop();
+}
+
+/**
+ * @brief Checks the three `pop_for()` outcomes on a queue of the given backend.
+ */
+template <typename Backend>
+static void ExpectTimedPopOutcomes() {
+    ThreadSafeQueue<int, Backend> q(4);
+    int val = 0;
+
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(q.pop_for(val, std::chrono::milliseconds(20)), PopStatus::Timeout);
+    EXPECT_GE(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(20))
+        << "pop_for() must wait for the whole timeout on an empty queue";
+
+    ASSERT_TRUE(q.push(7));
+    q.close();
+    EXPECT_EQ(q.pop_for(val, std::chrono::milliseconds(20)), PopStatus::Item)
+        << "Elements stored before close() must still be returned";
+    EXPECT_EQ(val, 7);
+    EXPECT_EQ(q.pop_for(val, std::chrono::seconds(5)), PopStatus::Closed)
+        << "A closed, drained queue must not wait for the timeout";
+}
+
+/**
+ * @test ThreadSafeQueue.TimedPopReportsTimeoutItemAndClosed
+ * @brief Validate pop_for() on every backend.
+ *
+ * @details
+ * GIVEN an empty queue of each backend
+ * WHEN pop_for() is called before and after an element is pushed and the queue closed
+ * THEN it must report Timeout, then Item with the pushed value, then Closed.
+ */
+TEST(ThreadSafeQueue, TimedPopReportsTimeoutItemAndClosed) {
+    ExpectTimedPopOutcomes<MutexBackend>();
+    ExpectTimedPopOutcomes<MpmcRingBackend>();
+    ExpectTimedPopOutcomes<SpscRingBackend>();
+}
+
+/**
+ * @test ThreadSafeQueue.PopUntilWakesOnPush
+ * @brief Ensure a consumer waiting in pop_until() is woken by a push, not its deadline.
+ *
+ * @details
+ * GIVEN consumers blocked in pop_until() with a deadline 5 s away
+ * WHEN a producer pushes an element 20 ms later
+ * THEN each consumer must receive it long before the deadline.
+ */
+TEST(ThreadSafeQueue, PopUntilWakesOnPush) {
+    ThreadSafeQueue<int> mutex_queue;
+    ThreadSafeQueue<int, MpmcRingBackend> ring_queue(16);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    PopStatus mutex_status = PopStatus::Timeout;
+    PopStatus ring_status = PopStatus::Timeout;
+    int mutex_val = 0;
+    int ring_val = 0;
+
+    std::thread mutex_consumer(
+        [&] { mutex_status = mutex_queue.pop_until(mutex_val, deadline); });
+    std::thread ring_consumer([&] { ring_status = ring_queue.pop_until(ring_val, deadline); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    mutex_queue.push(1);
+    ring_queue.push(2);
+    mutex_consumer.join();
+    ring_consumer.join();
+
+    EXPECT_EQ(mutex_status, PopStatus::Item);
+    EXPECT_EQ(mutex_val, 1);
+    EXPECT_EQ(ring_status, PopStatus::Item);
+    EXPECT_EQ(ring_val, 2);
+    EXPECT_LT(std::chrono::steady_clock::now(), deadline - std::chrono::seconds(4))
+        << "Consumers must be woken by the push, not by the deadline";
+}
+
+/**
+ * @test PriorityQueue.ServesHigherLevelsFirstFifoWithin
+ * @brief Validate the serving order of the priority backend.
+ *
+ * @details
+ * GIVEN a PriorityBackend queue with elements pushed at mixed levels
+ * WHEN they are popped
+ * THEN higher levels must come first and each level must keep its FIFO order.
+ */
+TEST(PriorityQueue, ServesHigherLevelsFirstFifoWithin) {
+    ThreadSafeQueue<int, PriorityBackend> q;
+    q.push(1, Priority::Low);
+    q.push(2);
+    q.push(3, Priority::High);
+    q.push(4, Priority::Low);
+    q.push(5, Priority::High);
+    EXPECT_TRUE(q.try_push(6, Priority::Critical));
+    EXPECT_EQ(q.size(), 6u);
+
+    std::vector<int> order;
+    ASSERT_EQ(q.try_pop_bulk(std::back_inserter(order), 10), 6u);
+    EXPECT_EQ(order, (std::vector<int>{6, 3, 5, 2, 1, 4}));
+    EXPECT_TRUE(q.empty());
+}
+
+/**
+ * @test PriorityQueue.AgingPromotesStarvedElements
+ * @brief Ensure aging lets a long-waiting low-priority element overtake newer urgent ones.
+ *
+ * @details
+ * GIVEN a Low element that has waited more than 3 aging intervals and a fresh High one
+ * WHEN the next element is popped
+ * THEN the aged Low element must be served first, while a queue without aging must
+ * still serve the High element first.
+ */
+TEST(PriorityQueue, AgingPromotesStarvedElements) {
+    ThreadSafeQueue<int, PriorityBackend> aged(0, std::chrono::milliseconds(10));
+    ThreadSafeQueue<int, PriorityBackend> strict;
+
+    aged.push(1, Priority::Low);
+    strict.push(1, Priority::Low);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    aged.push(2, Priority::High);
+    strict.push(2, Priority::High);
+
+    int val = 0;
+    ASSERT_TRUE(aged.pop(val));
+    EXPECT_EQ(val, 1) << "The aged Low element must outrank the new High one";
+    ASSERT_TRUE(strict.pop(val));
+    EXPECT_EQ(val, 2) << "Without aging, priorities must stay strict";
+}
+
+/**
+ * @test PriorityQueue.AgingKeepsOrderWhenEveryLevelWaited
+ * @brief Ensure aging credits the top level too, so it does not invert priorities.
+ *
+ * @details
+ * GIVEN a Low and a High element pushed together on a queue with a 5 ms aging interval
+ * WHEN both have waited about 6 intervals before the first pop
+ * THEN the High element (2 + 6) must still outrank the Low one (0 + 6).
+ */
+TEST(PriorityQueue, AgingKeepsOrderWhenEveryLevelWaited) {
+    ThreadSafeQueue<int, PriorityBackend> q(0, std::chrono::milliseconds(5));
+
+    q.push(1, Priority::Low);
+    q.push(2, Priority::High);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+    int val = 0;
+    ASSERT_TRUE(q.pop(val));
+    EXPECT_EQ(val, 2) << "An equally old High element must not lose to an aged Low one";
+    ASSERT_TRUE(q.pop(val));
+    EXPECT_EQ(val, 1);
+}
+
+/**
+ * @test WorkerPool.PrioritySubmitRunsUrgentTasksFirst
+ * @brief Verify that submit() forwards the priority to a PriorityBackend queue.
+ *
+ * @details
+ * GIVEN a single-worker pool on a PriorityBackend queue, busy with a blocking task
+ * WHEN Low tasks and then a High task are submitted
+ * THEN the High task must run before every Low task once the worker is free.
+ */
+TEST(WorkerPool, PrioritySubmitRunsUrgentTasksFirst) {
+    ThreadSafeQueue<Task, PriorityBackend> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+    pool.submit(Task([gate] { gate.wait(); }));
+
+    std::mutex order_mtx;
+    std::vector<int> order;
+    auto record = [&order_mtx, &order](int id) {
+        std::lock_guard<std::mutex> lock(order_mtx);
+        order.push_back(id);
+    };
+
+    for (int i = 0; i < 3; ++i) pool.submit(Task([record, i] { record(i); }), Priority::Low);
+    auto urgent = pool.submit(Priority::High, [record] {
+        record(100);
+        return 7;
+    });
+
+    release.set_value();
+    EXPECT_EQ(urgent.get(), 7);
+    pool.wait_idle();
+    pool.stop();
+
+    EXPECT_EQ(order, (std::vector<int>{100, 0, 1, 2}));
+}
+
+/**
+ * @test WorkerPool.ScheduledTasksRunAfterTheirDelay
+ * @brief Validate schedule_after() and schedule_at().
+ *
+ * @details
+ * GIVEN a running pool
+ * WHEN one task is scheduled 30 ms ahead and another at an absolute time 10 ms ahead
+ * THEN neither must run early, the absolute one must run first and both handles must
+ * stop reporting pending once their task was submitted.
+ */
+TEST(WorkerPool, ScheduledTasksRunAfterTheirDelay) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    using Clock = std::chrono::steady_clock;
+    std::promise<Clock::time_point> delayed;
+    std::promise<Clock::time_point> absolute;
+    std::future<Clock::time_point> delayed_done = delayed.get_future();
+    std::future<Clock::time_point> absolute_done = absolute.get_future();
+
+    const auto begin = Clock::now();
+    TimerHandle after = pool.schedule_after(std::chrono::milliseconds(30),
+                                            [&delayed] { delayed.set_value(Clock::now()); });
+    TimerHandle at = pool.schedule_at(begin + std::chrono::milliseconds(10),
+                                      [&absolute] { absolute.set_value(Clock::now()); });
+    EXPECT_TRUE(after.pending());
+
+    ASSERT_EQ(delayed_done.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    ASSERT_EQ(absolute_done.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    const auto delayed_at = delayed_done.get();
+    const auto absolute_at = absolute_done.get();
+
+    EXPECT_GE(delayed_at - begin, std::chrono::milliseconds(30));
+    EXPECT_GE(absolute_at - begin, std::chrono::milliseconds(10));
+    EXPECT_LT(absolute_at, delayed_at);
+    EXPECT_FALSE(after.pending());
+    EXPECT_FALSE(at.cancel()) << "A fired timer can no longer be cancelled";
+
+    pool.stop();
+}
+
+/**
+ * @test WorkerPool.CancelledTimersNeverRun
+ * @brief Ensure cancel() prevents a timer from firing, also at scale.
+ *
+ * @details
+ * GIVEN one timer due in 20 ms and 50 000 timers due in an hour
+ * WHEN they are all cancelled
+ * THEN cancel() must report success, none of the tasks may run, and stop() must
+ * discard the remaining entries.
+ */
+TEST(WorkerPool, CancelledTimersNeverRun) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+
+    std::atomic<int> runs{0};
+    TimerHandle soon = pool.schedule_after(std::chrono::milliseconds(20), [&runs] { runs++; });
+    EXPECT_TRUE(soon.cancel());
+    EXPECT_FALSE(soon.cancel()) << "A timer is cancelled only once";
+
+    std::vector<TimerHandle> later;
+    later.reserve(50000);
+    for (int i = 0; i < 50000; ++i)
+        later.push_back(pool.schedule_after(std::chrono::hours(1), [&runs] { runs++; }));
+    for (auto& handle : later) ASSERT_TRUE(handle.cancel());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    pool.wait_idle();
+    EXPECT_EQ(runs.load(), 0);
+
+    pool.stop();
+    EXPECT_FALSE(later.front().pending());
+}
+
+/**
+ * @test WorkerPool.PeriodicTaskRepeatsUntilCancelled
+ * @brief Validate schedule_every() and its cancellation.
+ *
+ * @details
+ * GIVEN a task scheduled every 5 ms
+ * WHEN it has run at least three times and is then cancelled
+ * THEN no further run must happen after the pool has gone idle.
+ */
+TEST(WorkerPool, PeriodicTaskRepeatsUntilCancelled) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    std::atomic<int> runs{0};
+    TimerHandle every = pool.schedule_every(std::chrono::milliseconds(5), [&runs] { runs++; });
+
+    const auto give_up = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (runs.load() < 3 && std::chrono::steady_clock::now() < give_up)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_GE(runs.load(), 3);
+
+    EXPECT_TRUE(every.cancel());
+    pool.wait_idle();
+    const int after_cancel = runs.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_EQ(runs.load(), after_cancel);
+
+    pool.stop();
+}
+
+/**
+ * @test TimerWheel.PeriodicTimerSurvivesARejectedDispatch
+ * @brief Validate that a rejected periodic run does not stop the timer.
+ *
+ * @details
+ * GIVEN a timing wheel whose dispatch rejects (and drops) the first task it receives
+ * WHEN a timer is scheduled every 2 ms
+ * THEN later periods must still be dispatched and run.
+ */
+TEST(TimerWheel, PeriodicTimerSurvivesARejectedDispatch) {
+    std::atomic<int> dispatched{0};
+    TimerWheel wheel([&dispatched](Task&& task) {
+        if (dispatched++ == 0) return false;
+        task();
+        return true;
+    });
+
+    std::atomic<int> runs{0};
+    TimerHandle every = wheel.schedule(std::chrono::steady_clock::now(),
+                                       std::chrono::milliseconds(2), Task([&runs] { runs++; }));
+
+    const auto give_up = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (runs.load() < 2 && std::chrono::steady_clock::now() < give_up)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_GE(runs.load(), 2);
+
+    every.cancel();
+    wheel.stop();
+}
+
+/**
+ * @test Strand.RunsTasksInOrderWithoutOverlap
+ * @brief Validate that a strand serializes its tasks on a multi-worker pool.
+ *
+ * @details
+ * GIVEN a strand on a 4-worker pool
+ * WHEN 2000 tasks are submitted to it, some of them returning a value
+ * THEN they must run in submission order, never two at a time, always reporting
+ *      running_in_this_thread(), and the futures must hold their results.
+ */
+TEST(Strand, RunsTasksInOrderWithoutOverlap) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(4);
+
+    Strand strand(pool);
+    std::vector<int> order;
+    std::atomic<int> active{0};
+    std::atomic<bool> overlapped{false};
+    std::atomic<bool> outside{false};
+
+    constexpr int total = 2000;
+    for (int i = 0; i < total; ++i) {
+        strand.submit([&, i] {
+            if (active.fetch_add(1) != 0) overlapped = true;
+            if (!strand.running_in_this_thread()) outside = true;
+            order.push_back(i);
+            active.fetch_sub(1);
+        });
+    }
+    auto size = strand.submit([&order] { return order.size(); });
+
+    EXPECT_EQ(size.get(), static_cast<std::size_t>(total));
+    pool.wait_idle();
+    EXPECT_FALSE(overlapped.load());
+    EXPECT_FALSE(outside.load());
+    EXPECT_FALSE(strand.running_in_this_thread());
+    for (int i = 0; i < total; ++i) ASSERT_EQ(order[i], i);
+
+    pool.stop();
+}
+
+/**
+ * @test Strand.ManyStrandsShareFewWorkers
+ * @brief Validate that idle strands do not hold workers.
+ *
+ * @details
+ * GIVEN 1000 strands on a 2-worker pool
+ * WHEN 20 tasks are submitted to each of them, interleaved across strands
+ * THEN every task must run and each strand must keep its own order.
+ */
+TEST(Strand, ManyStrandsShareFewWorkers) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    constexpr int strands_count = 1000;
+    constexpr int per_strand = 20;
+    std::vector<std::unique_ptr<Strand>> strands;
+    std::vector<std::vector<int>> seen(strands_count);
+    for (int s = 0; s < strands_count; ++s) strands.emplace_back(new Strand(pool));
+
+    for (int i = 0; i < per_strand; ++i)
+        for (int s = 0; s < strands_count; ++s)
+            strands[s]->submit([&seen, s, i] { seen[s].push_back(i); });
+
+    pool.wait_idle();
+    for (int s = 0; s < strands_count; ++s) {
+        ASSERT_EQ(seen[s].size(), static_cast<std::size_t>(per_strand));
+        for (int i = 0; i < per_strand; ++i) ASSERT_EQ(seen[s][i], i);
+    }
+
+    pool.stop();
+}
+
+/**
+ * @test Strand.KeepsRunningAfterExceptionAndDestruction
+ * @brief Validate exception isolation and tasks outliving their strand.
+ *
+ * @details
+ * GIVEN a strand whose first task throws
+ * WHEN more tasks are submitted and the strand is destroyed before they run
+ * THEN the remaining tasks must still run, in order.
+ */
+TEST(Strand, KeepsRunningAfterExceptionAndDestruction) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+
+    std::vector<int> order;
+    {
+        Strand strand(pool);
+        strand.submit([] { throw std::runtime_error("strand failure"); });
+        for (int i = 0; i < 5; ++i) strand.submit([&order, i] { order.push_back(i); });
+    }
+
+    pool.start(2);
+    pool.wait_idle();
+    ASSERT_EQ(order.size(), 5u);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(order[i], i);
+
+    pool.stop();
+}
+
+/**
+ * @test Strand.RejectedDrainDropsPendingTasks
+ * @brief Validate a strand whose pool refuses the drain task.
+ *
+ * @details
+ * GIVEN a strand on a pool that has been stopped
+ * WHEN tasks and a future-returning task are submitted to it
+ * THEN no task must run, the future must report broken_promise instead of hanging,
+ *      and the strand must try again (and drop again) on later submits.
+ */
+TEST(Strand, RejectedDrainDropsPendingTasks) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+    pool.stop();
+
+    Strand strand(pool);
+    std::atomic<int> runs{0};
+    strand.submit([&runs] { runs++; });
+    TaskFuture<int> dropped = strand.submit([] { return 1; });
+    try {
+        dropped.get();
+        FAIL() << "a task of a rejected strand must not run";
+    } catch (const std::future_error& e) {
+        EXPECT_EQ(e.code(), std::make_error_code(std::future_errc::broken_promise));
+    }
+    strand.submit([&runs] { runs++; });
+    EXPECT_EQ(runs.load(), 0);
+}
+
+/**
+ * @test Strand.SkipsCancelledAndExpiredTasks
+ * @brief Validate that strand tasks honor cancellation tokens and deadlines.
+ *
+ * @details
+ * GIVEN a strand whose drain is held by a gate task
+ * WHEN a task with a cancelled token, a task with a passed deadline and a plain task
+ *      are queued behind the gate
+ * THEN only the plain task must run, and the pool's stats must count one cancelled
+ *      and one expired task.
+ */
+TEST(Strand, SkipsCancelledAndExpiredTasks) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    Strand strand(pool);
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    strand.submit([opened] { opened.wait(); });
+
+    std::atomic<int> runs{0};
+    CancellationSource source;
+    Task cancelled([&runs] { runs++; });
+    cancelled.set_cancellation_token(source.token());
+    Task expired([&runs] { runs++; });
+    expired.set_deadline(std::chrono::steady_clock::now() - std::chrono::milliseconds(1));
+    strand.submit(std::move(cancelled));
+    strand.submit(std::move(expired));
+    strand.submit([&runs] { runs += 10; });
+
+    source.cancel();
+    gate.set_value();
+    pool.wait_idle();
+
+    EXPECT_EQ(runs.load(), 10);
+    const WorkerPool::Stats stats = pool.stats();
+    EXPECT_EQ(stats.cancelled, 1u);
+    EXPECT_EQ(stats.expired, 1u);
+
+    pool.stop();
+}
+
+/**
+ * @test ParallelFor.CoversEveryIndexOnceAndHonorsGrain
+ * @brief Validate parallel_for() with explicit and automatic grain.
+ *
+ * @details
+ * GIVEN a 4-worker pool and a range of 100000 indices
+ * WHEN parallel_for() runs with grain 1000 and then with AUTO_GRAIN
+ * THEN every index must be visited exactly once, explicit-grain leaves must not exceed
+ *      1000 indices, and the calling thread must have processed part of the range.
+ */
+TEST(ParallelFor, CoversEveryIndexOnceAndHonorsGrain) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(4);
+
+    constexpr std::size_t total = 100000;
+    for (std::size_t grain : {std::size_t(1000), AUTO_GRAIN}) {
+        std::vector<std::atomic<int>> visits(total);
+        for (auto& v : visits) v.store(0);
+        std::atomic<std::size_t> largest_leaf{0};
+        std::atomic<bool> caller_helped{false};
+        const std::thread::id caller = std::this_thread::get_id();
+
+        parallel_for(pool, IndexRange{0, total}, grain, [&](IndexRange r) {
+            if (std::this_thread::get_id() == caller) caller_helped = true;
+            std::size_t seen = largest_leaf.load();
+            while (r.size() > seen && !largest_leaf.compare_exchange_weak(seen, r.size())) {
+            }
+            for (std::size_t i = r.begin; i < r.end; ++i) visits[i]++;
+        });
+
+        for (std::size_t i = 0; i < total; ++i) ASSERT_EQ(visits[i].load(), 1) << "index " << i;
+        if (grain != AUTO_GRAIN) {
+            EXPECT_LE(largest_leaf.load(), grain);
+        }
+        EXPECT_TRUE(caller_helped.load());
+    }
+
+    pool.stop();
+}
+
+/**
+ * @test ParallelReduce.CombinesLeavesInIndexOrder
+ * @brief Validate parallel_reduce() with commutative and non-commutative combines.
+ *
+ * @details
+ * GIVEN a 3-worker pool
+ * WHEN a sum over 1..200000 and a concatenation of the digits of 0..4999 are reduced
+ * THEN the sum must match the closed form and the string must equal the sequential one.
+ */
+TEST(ParallelReduce, CombinesLeavesInIndexOrder) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(3);
+
+    const std::size_t n = 200000;
+    const unsigned long long sum = parallel_reduce(
+        pool, IndexRange{1, n + 1}, 0ULL,
+        [](IndexRange r, unsigned long long acc) {
+            for (std::size_t i = r.begin; i < r.end; ++i) acc += i;
+            return acc;
+        },
+        [](unsigned long long a, unsigned long long b) { return a + b; });
+    EXPECT_EQ(sum, static_cast<unsigned long long>(n) * (n + 1) / 2);
+
+    std::string expected;
+    for (int i = 0; i < 5000; ++i) expected += static_cast<char>('0' + i % 10);
+    const std::string text = parallel_reduce(
+        pool, IndexRange{0, 5000}, std::string(),
+        [](IndexRange r, std::string acc) {
+            for (std::size_t i = r.begin; i < r.end; ++i) acc += static_cast<char>('0' + i % 10);
+            return acc;
+        },
+        [](std::string a, const std::string& b) { return a + b; }, 16);
+    EXPECT_EQ(text, expected);
+
+    pool.stop();
+}
+
+/**
+ * @test ParallelFor.NestedCallsAndExceptions
+ * @brief Validate nesting on a single worker and exception propagation.
+ *
+ * @details
+ * GIVEN a 1-worker pool
+ * WHEN a pool task runs parallel_for() itself, and a body throws on one index
+ * THEN the nested loop must complete (the caller helps instead of blocking the only
+ *      worker) and the exception must reach the caller of parallel_for().
+ */
+TEST(ParallelFor, NestedCallsAndExceptions) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+
+    std::atomic<std::size_t> visited{0};
+    auto nested = pool.submit([&pool, &visited] {
+        parallel_for(pool, IndexRange{0, 10000}, 10, [&visited](IndexRange r) {
+            visited += r.size();
+        });
+    });
+    nested.get();
+    EXPECT_EQ(visited.load(), 10000u);
+
+    EXPECT_THROW(parallel_for(pool, IndexRange{0, 1000}, 1,
+                              [](IndexRange r) {
+                                  if (r.begin <= 500 && 500 < r.end)
+                                      throw std::runtime_error("bad index");
+                              }),
+                 std::runtime_error);
+
+    pool.wait_idle();
+    pool.stop();
+}
+
+/**
+ * @test TaskGraph.RunsNodesAfterTheirPredecessorsAndReruns
+ * @brief Validate dependency order and re-running a finished graph.
+ *
+ * @details
+ * GIVEN a diamond graph (a -> b, a -> c, b -> d, c -> d) plus a 64-node fan-in to d
+ * WHEN it is run three times on a 4-worker pool
+ * THEN every node must run once per run, each after all of its predecessors.
+ */
+TEST(TaskGraph, RunsNodesAfterTheirPredecessorsAndReruns) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(4);
+
+    std::mutex mtx;
+    std::vector<std::string> log;
+    auto record = [&mtx, &log](std::string name) {
+        return [&mtx, &log, name] {
+            std::lock_guard<std::mutex> lock(mtx);
+            log.push_back(name);
+        };
+    };
+
+    TaskGraph graph;
+    const auto a = graph.add_node(record("a"));
+    const auto b = graph.add_node(record("b"));
+    const auto c = graph.add_node(record("c"));
+    const auto d = graph.add_node(record("d"));
+    graph.add_edge(a, b);
+    graph.add_edge(a, c);
+    graph.add_edge(b, d);
+    graph.add_edge(c, d);
+    for (int i = 0; i < 64; ++i) graph.add_edge(graph.add_node(record("x")), d);
+    EXPECT_EQ(graph.size(), 68u);
+
+    for (int run = 0; run < 3; ++run) {
+        log.clear();
+        graph.run(pool);
+
+        ASSERT_EQ(log.size(), 68u);
+        auto position = [&log](const std::string& name) {
+            return std::find(log.begin(), log.end(), name) - log.begin();
+        };
+        EXPECT_LT(position("a"), position("b"));
+        EXPECT_LT(position("a"), position("c"));
+        EXPECT_EQ(log.back(), "d");
+        EXPECT_EQ(std::count(log.begin(), log.end(), "x"), 64);
+    }
+
+    pool.stop();
+}
+
+/**
+ * @test TaskGraph.RejectsCyclesAndInvalidEdges
+ * @brief Validate graph construction errors.
+ *
+ * @details
+ * GIVEN a graph with two nodes
+ * WHEN a self edge, an edge to an unknown node or a cycle is declared
+ * THEN add_edge() must throw for the first two and start() for the cycle.
+ */
+TEST(TaskGraph, RejectsCyclesAndInvalidEdges) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+
+    TaskGraph graph;
+    const auto a = graph.add_node([] {});
+    const auto b = graph.add_node([] {});
+    EXPECT_THROW(graph.add_edge(a, a), std::invalid_argument);
+    EXPECT_THROW(graph.add_edge(a, 7), std::out_of_range);
+
+    graph.add_edge(a, b);
+    graph.add_edge(b, a);
+    EXPECT_THROW(graph.start(pool), std::logic_error);
+
+    pool.stop();
+}
+
+/**
+ * @test TaskGraph.FailedNodeSkipsDependentsAndRethrows
+ * @brief Validate exception handling during a run.
+ *
+ * @details
+ * GIVEN a chain first -> second -> third where second throws
+ * WHEN the graph is run
+ * THEN run() must rethrow, third must be skipped, and a later run of a fixed graph
+ *      must execute every node again.
+ */
+TEST(TaskGraph, FailedNodeSkipsDependentsAndRethrows) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    std::atomic<int> first_runs{0};
+    std::atomic<int> third_runs{0};
+    std::atomic<bool> fail{true};
+
+    TaskGraph graph;
+    const auto first = graph.add_node([&first_runs] { first_runs++; });
+    const auto second = graph.add_node([&fail] {
+        if (fail.load()) throw std::runtime_error("stage failed");
+    });
+    const auto third = graph.add_node([&third_runs] { third_runs++; });
+    graph.add_edge(first, second);
+    graph.add_edge(second, third);
+
+    EXPECT_THROW(graph.run(pool), std::runtime_error);
+    EXPECT_EQ(first_runs.load(), 1);
+    EXPECT_EQ(third_runs.load(), 0);
+
+    fail = false;
+    graph.run(pool);
+    EXPECT_EQ(first_runs.load(), 2);
+    EXPECT_EQ(third_runs.load(), 1);
+
+    pool.stop();
+}
+
+/**
+ * @test TaskGraph.RunOnStoppedPoolFailsInsteadOfHanging
+ * @brief Validate that node tasks rejected by the pool fail the run.
+ *
+ * @details
+ * GIVEN a pool that has been stopped (its queue is closed) and a graph with two roots
+ *       feeding a fan-out and a join
+ * WHEN the graph is run on it
+ * THEN run() must throw std::runtime_error instead of blocking, no node body must
+ *      run, and the graph must be destructible right away.
+ */
+TEST(TaskGraph, RunOnStoppedPoolFailsInsteadOfHanging) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+    pool.stop();
+
+    std::atomic<int> runs{0};
+    {
+        TaskGraph graph;
+        const auto left = graph.add_node([&runs] { runs++; });
+        const auto right = graph.add_node([&runs] { runs++; });
+        const auto join = graph.add_node([&runs] { runs++; });
+        graph.add_edge(left, join);
+        graph.add_edge(right, join);
+        for (int i = 0; i < 4; ++i) graph.add_edge(left, graph.add_node([&runs] { runs++; }));
+
+        EXPECT_THROW(graph.run(pool), std::runtime_error);
+        EXPECT_THROW(graph.run(pool), std::runtime_error);
+    }
+    EXPECT_EQ(runs.load(), 0);
+}
+
+/**
+ * @test TaskFuture.ThenChainsContinuationsOnThePool
+ * @brief Validate then() chaining, void antecedents and exception forwarding.
+ *
+ * @details
+ * GIVEN a 2-worker pool
+ * WHEN a result is transformed by two continuations, a void task is continued, and a
+ *      failing task is continued
+ * THEN the final values must be produced, and the failure must skip the continuation
+ *      body and reach get().
+ */
+TEST(TaskFuture, ThenChainsContinuationsOnThePool) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    TaskFuture<std::string> text = pool.submit([] { return 21; })
+                                       .then(pool, [](int value) { return value * 2; })
+                                       .then(pool, [](int value) { return std::to_string(value); });
+    EXPECT_EQ(text.get(), "42");
+
+    std::atomic<int> steps{0};
+    TaskFuture<int> after_void =
+        pool.submit([&steps] { steps++; }).then(pool, [&steps] { return ++steps; });
+    EXPECT_EQ(after_void.get(), 2);
+
+    std::atomic<bool> continued{false};
+    TaskFuture<int> failed = pool.submit([]() -> int { throw std::runtime_error("stage"); })
+                                 .then(pool, [&continued](int value) {
+                                     continued = true;
+                                     return value;
+                                 });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+    EXPECT_FALSE(continued.load());
+
+    TaskFuture<int> ready = pool.submit([] { return 1; });
+    ready.wait();
+    EXPECT_EQ(ready.then(pool, [](int value) { return value + 1; }).get(), 2);
+    EXPECT_FALSE(ready.valid());
+
+    pool.stop();
+}
+
+/**
+ * @test TaskFuture.WhenAllJoinsWithoutBlockingWorkers
+ * @brief Validate when_all() fan-in on a single worker.
+ *
+ * @details
+ * GIVEN a 1-worker pool and 100 submitted tasks
+ * WHEN their futures are joined with when_all() and summed in a continuation
+ * THEN the sum must be correct although no thread of the pool ever waits, and an
+ *      empty when_all() must be ready at once.
+ */
+TEST(TaskFuture, WhenAllJoinsWithoutBlockingWorkers) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+
+    std::vector<TaskFuture<int>> parts;
+    for (int i = 1; i <= 100; ++i) parts.push_back(pool.submit([i] { return i; }));
+
+    TaskFuture<int> total =
+        when_all(std::move(parts)).then(pool, [](std::vector<TaskFuture<int>> all) {
+            int sum = 0;
+            for (auto& part : all) sum += part.get();
+            return sum;
+        });
+    EXPECT_EQ(total.get(), 5050);
+
+    TaskFuture<std::vector<TaskFuture<int>>> none = when_all(std::vector<TaskFuture<int>>());
+    EXPECT_TRUE(none.is_ready());
+    EXPECT_TRUE(none.get().empty());
+
+    pool.stop();
+}
+
+/**
+ * @test TaskFuture.WhenAnyReportsTheFirstReadyInput
+ * @brief Validate when_any() while other inputs are still running.
+ *
+ * @details
+ * GIVEN a slow task blocked on a gate and a fast task
+ * WHEN their futures are passed to when_any()
+ * THEN the result must become ready with the fast task's index before the gate opens.
+ */
+TEST(TaskFuture, WhenAnyReportsTheFirstReadyInput) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+
+    std::vector<TaskFuture<int>> inputs;
+    inputs.push_back(pool.submit([opened] {
+        opened.wait();
+        return 1;
+    }));
+    inputs.push_back(pool.submit([] { return 2; }));
+
+    WhenAnyResult<int> first = when_any(std::move(inputs)).get();
+    EXPECT_EQ(first.index, 1u);
+    EXPECT_EQ(first.futures[1].get(), 2);
+    EXPECT_FALSE(first.futures[0].is_ready());
+
+    gate.set_value();
+    EXPECT_EQ(first.futures[0].get(), 1);
+
+    pool.stop();
+}
+
+/**
+ * @test TaskFuture.WhenAnyLosersCanBeCombinedAgain
+ * @brief Validate that when_any() hands back its losers without its callbacks.
+ *
+ * @details
+ * GIVEN three tasks, two of them blocked on their own gates
+ * WHEN when_any() reports the fast one and the two losers go through when_any() again
+ * THEN the second call must not throw and must report the first gate opened, and the
+ *      remaining loser must still accept then().
+ */
+TEST(TaskFuture, WhenAnyLosersCanBeCombinedAgain) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(3);
+
+    std::promise<void> first_gate;
+    std::promise<void> second_gate;
+    std::shared_future<void> first_open = first_gate.get_future().share();
+    std::shared_future<void> second_open = second_gate.get_future().share();
+
+    std::vector<TaskFuture<int>> inputs;
+    inputs.push_back(pool.submit([first_open] {
+        first_open.wait();
+        return 1;
+    }));
+    inputs.push_back(pool.submit([] { return 2; }));
+    inputs.push_back(pool.submit([second_open] {
+        second_open.wait();
+        return 3;
+    }));
+
+    WhenAnyResult<int> first = when_any(std::move(inputs)).get();
+    ASSERT_EQ(first.index, 1u);
+
+    std::vector<TaskFuture<int>> rest;
+    rest.push_back(std::move(first.futures[0]));
+    rest.push_back(std::move(first.futures[2]));
+    TaskFuture<WhenAnyResult<int>> again = when_any(std::move(rest));
+
+    first_gate.set_value();
+    WhenAnyResult<int> second = again.get();
+    ASSERT_EQ(second.index, 0u);
+    EXPECT_EQ(second.futures[0].get(), 1);
+
+    TaskFuture<int> last = second.futures[1].then(pool, [](int v) { return v * 10; });
+    second_gate.set_value();
+    EXPECT_EQ(last.get(), 30);
+
+    pool.stop();
+}
+
+/**
+ * @test TaskFuture.CombinatorsRejectBadInputsBeforeAttaching
+ * @brief Validate when_all() / when_any() input checks.
+ *
+ * @details
+ * GIVEN a pending future next to an invalid one, or next to one that already has a callback
+ * WHEN they are passed to when_all() / when_any()
+ * THEN the call must throw the matching future_error without attaching a callback to the
+ *      pending future, so its shared state is freed once its task is dropped.
+ */
+TEST(TaskFuture, CombinatorsRejectBadInputsBeforeAttaching) {
+    auto sentinel = std::make_shared<int>(0);
+
+    {
+        auto packaged = make_future_task([sentinel] { return *sentinel; });
+
+        std::vector<TaskFuture<int>> inputs;
+        inputs.push_back(std::move(packaged.second));
+        inputs.push_back(TaskFuture<int>());
+
+        try {
+            when_all(std::move(inputs));
+            ADD_FAILURE() << "when_all() accepted an invalid future";
+        } catch (const std::future_error& e) {
+            EXPECT_EQ(e.code(), std::future_errc::no_state);
+        }
+    }
+    EXPECT_EQ(sentinel.use_count(), 1);
+
+    {
+        auto pending  = make_future_task([sentinel] { return *sentinel; });
+        auto attached = make_future_task([] { return 0; });
+        attached.second.on_ready(Task([] {}));
+        EXPECT_TRUE(attached.second.has_continuation());
+
+        std::vector<TaskFuture<int>> inputs;
+        inputs.push_back(std::move(pending.second));
+        inputs.push_back(std::move(attached.second));
+
+        try {
+            when_any(std::move(inputs));
+            ADD_FAILURE() << "when_any() accepted a future that already has a callback";
+        } catch (const std::future_error& e) {
+            EXPECT_EQ(e.code(), std::future_errc::future_already_retrieved);
+        }
+    }
+    EXPECT_EQ(sentinel.use_count(), 1);
+}
+
+/**
+ * @test Cancellation.SourceAndTokensShareOneFlag
+ * @brief Validate CancellationSource / CancellationToken semantics and Task transport.
+ *
+ * @details
+ * GIVEN a source, a copy of it, tokens and a default token
+ * WHEN the copy is cancelled twice and a token travels inside moved Tasks
+ * THEN only the first cancel() must report true, every token of the flag must see it,
+ *      the default token must never be cancelled and the moved Task keeps its token.
+ */
+TEST(Cancellation, SourceAndTokensShareOneFlag) {
+    CancellationSource source;
+    CancellationSource copy = source;
+    CancellationToken token = source.token();
+    CancellationToken never;
+
+    Task task([] {});
+    task.set_cancellation_token(copy.token());
+    Task moved = std::move(task);
+    Task assigned;
+    assigned = std::move(moved);
+
+    EXPECT_TRUE(token.can_be_cancelled());
+    EXPECT_FALSE(never.can_be_cancelled());
+    EXPECT_FALSE(token.is_cancelled());
+
+    EXPECT_TRUE(copy.cancel());
+    EXPECT_FALSE(source.cancel());
+    EXPECT_TRUE(source.is_cancelled());
+    EXPECT_TRUE(token.is_cancelled());
+    EXPECT_TRUE(assigned.cancellation_token().is_cancelled());
+    EXPECT_FALSE(moved.cancellation_token().can_be_cancelled());
+    EXPECT_FALSE(never.is_cancelled());
+}
+
+/**
+ * @test Cancellation.QueuedTasksAreSkippedAtDequeue
+ * @brief Validate that cancelled tasks never run but are accounted for.
+ *
+ * @details
+ * GIVEN a 1-worker pool blocked by a first task, with 1000 tokened and 10 plain
+ *       tasks queued behind it
+ * WHEN the source is cancelled and the worker is released
+ * THEN no tokened task may run, the plain ones must run, wait_idle() must return and
+ *      stats().cancelled must be 1000.
+ */
+TEST(Cancellation, QueuedTasksAreSkippedAtDequeue) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    pool.submit([opened] { opened.wait(); });
+
+    CancellationSource client;
+    std::atomic<int> stale{0};
+    std::atomic<int> plain{0};
+    for (int i = 0; i < 1000; ++i) pool.submit(Task([&stale] { stale++; }), client.token());
+    for (int i = 0; i < 10; ++i) pool.submit([&plain] { plain++; });
+
+    client.cancel();
+    gate.set_value();
+    pool.wait_idle();
+
+    EXPECT_EQ(stale.load(), 0);
+    EXPECT_EQ(plain.load(), 10);
+    EXPECT_EQ(pool.stats().cancelled, 1000u);
+
+    pool.stop();
+}
+
+/**
+ * @test Cancellation.FuturesAndRunningTasksObserveTheToken
+ * @brief Validate future-returning submit with a token and polling from a running task.
+ *
+ * @details
+ * GIVEN a pool with a long-running task polling its token and a future-returning
+ *       task submitted with an already cancelled token
+ * WHEN the running task's source is cancelled
+ * THEN it must return early with its partial count, and the dropped task's future
+ *      must report broken_promise.
+ */
+TEST(Cancellation, FuturesAndRunningTasksObserveTheToken) {
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    pool.start(2);
+
+    CancellationSource job;
+    std::atomic<bool> started{false};
+    const CancellationToken token = job.token();
+    TaskFuture<int> polling = pool.submit(token, [token, &started] {
+        int rounds = 0;
+        started = true;
+        while (!token.is_cancelled()) {
+            ++rounds;
+            std::this_thread::yield();
+        }
+        return rounds;
+    });
+    while (!started.load()) std::this_thread::yield();
+    job.cancel();
+    EXPECT_GE(polling.get(), 0);
+
+    CancellationSource gone;
+    gone.cancel();
+    TaskFuture<int> dropped = pool.submit(gone.token(), [] { return 1; });
+    try {
+        dropped.get();
+        FAIL() << "a task with a cancelled token must not run";
+    } catch (const std::future_error& e) {
+        EXPECT_EQ(e.code(), std::make_error_code(std::future_errc::broken_promise));
+    }
+
+    pool.stop();
+}
+
+/**
+ * @test DeadlineQueue.ServesEarliestDeadlineFirst
+ * @brief Validate the EDF order of the DeadlineBackend queue.
+ *
+ * @details
+ * GIVEN a DeadlineBackend queue holding tasks pushed in scrambled deadline order,
+ *       two of them sharing a deadline and two without one
+ * WHEN the tasks are popped and run
+ * THEN they must come out by increasing deadline, FIFO among equal deadlines, with
+ *      the tasks without a deadline last in push order.
+ */
+TEST(DeadlineQueue, ServesEarliestDeadlineFirst) {
+    using clock = std::chrono::steady_clock;
+    const clock::time_point base = clock::now() + std::chrono::seconds(10);
+
+    ThreadSafeQueue<Task, DeadlineBackend> q;
+    std::vector<int> order;
+    auto push = [&](int id, int offset_ms) {
+        Task task([&order, id] { order.push_back(id); });
+        if (offset_ms >= 0) task.set_deadline(base + std::chrono::milliseconds(offset_ms));
+        EXPECT_TRUE(q.push(std::move(task)));
+    };
+    push(1, -1);
+    push(2, 30);
+    push(3, 10);
+    push(4, 20);
+    push(5, -1);
+    push(6, 10);
+
+    EXPECT_EQ(q.size(), 6u);
+    Task task;
+    for (std::size_t i = 0; i < 6; ++i) {
+        ASSERT_TRUE(q.pop(task));
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{3, 6, 4, 2, 1, 5}));
+    EXPECT_TRUE(q.empty());
+}
+
+/**
+ * @test WorkerPool.ExpiredTasksAreShedWithCallback
+ * @brief Validate that tasks dequeued after their deadline are shed and reported.
+ *
+ * @details
+ * GIVEN a single-worker pool blocked by a gate, with an expiry callback installed
+ * WHEN tasks with already passed deadlines, tasks with distant deadlines and plain
+ *      tasks are queued behind the gate and the gate is opened
+ * THEN only the expired tasks must skip their body, each must reach the callback
+ *      once, stats().expired must count them and wait_idle() must still return.
+ */
+TEST(WorkerPool, ExpiredTasksAreShedWithCallback) {
+    using clock = std::chrono::steady_clock;
+
+    ThreadSafeQueue<Task> queue;
+    WorkerPool pool(queue);
+    std::atomic<int> shed{0};
+    pool.set_expiry_callback([&shed](Task&& task) {
+        EXPECT_TRUE(static_cast<bool>(task));
+        shed++;
+    });
+    pool.start(1);
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    pool.submit([opened] { opened.wait(); });
+
+    std::atomic<int> late{0};
+    std::atomic<int> timely{0};
+    const clock::time_point past = clock::now() - std::chrono::milliseconds(1);
+    const clock::time_point future = clock::now() + std::chrono::hours(1);
+    for (int i = 0; i < 100; ++i) pool.submit(Task([&late] { late++; }), past);
+    for (int i = 0; i < 10; ++i) pool.submit(Task([&timely] { timely++; }), future);
+    for (int i = 0; i < 10; ++i) pool.submit([&timely] { timely++; });
+
+    gate.set_value();
+    pool.wait_idle();
+
+    EXPECT_EQ(late.load(), 0);
+    EXPECT_EQ(timely.load(), 20);
+    EXPECT_EQ(shed.load(), 100);
+    EXPECT_EQ(pool.stats().expired, 100u);
+
+    pool.stop();
+}
+
+/**
+ * @test WorkerPool.DeadlineQueueRunsUrgentWorkFirst
+ * @brief Validate a pool on a DeadlineBackend queue and the future-returning overload.
+ *
+ * @details
+ * GIVEN a single-worker pool on a DeadlineBackend queue, blocked by a gate
+ * WHEN tasks are submitted with decreasing deadlines and one future-returning task
+ *      is submitted with a deadline that has already passed
+ * THEN the remaining tasks must run in deadline order and the shed task's future
+ *      must report broken_promise.
+ */
+TEST(WorkerPool, DeadlineQueueRunsUrgentWorkFirst) {
+    using clock = std::chrono::steady_clock;
+
+    ThreadSafeQueue<Task, DeadlineBackend> queue;
+    WorkerPool pool(queue);
+    pool.start(1);
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    pool.submit([opened] { opened.wait(); });
+
+    const clock::time_point base = clock::now() + std::chrono::hours(1);
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i)
+        pool.submit(Task([&order, i] { order.push_back(i); }),
+                    base - std::chrono::seconds(i));
+    TaskFuture<int> dropped =
+        pool.submit(clock::now() - std::chrono::milliseconds(1), [] { return 1; });
+
+    gate.set_value();
+    pool.wait_idle();
+
+    EXPECT_EQ(order, (std::vector<int>{4, 3, 2, 1, 0}));
+    try {
+        dropped.get();
+        FAIL() << "a task dequeued past its deadline must not run";
+    } catch (const std::future_error& e) {
+        EXPECT_EQ(e.code(), std::make_error_code(std::future_errc::broken_promise));
+    }
+    EXPECT_EQ(pool.stats().expired, 1u);
+
+    pool.stop();
+}